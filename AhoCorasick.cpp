@@ -0,0 +1,156 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "AhoCorasick.h"
+#include <algorithm>
+
+AhoCorasick::AhoCorasick()
+    : m_patternCount(0)
+    , m_built(false)
+{
+    m_nodes.append({{}, 0, -1, -1, 0});
+}
+
+void AhoCorasick::addPattern(const QString& pattern, int patternId)
+{
+    if (pattern.isEmpty()) {
+        return;
+    }
+    
+    int state = 0;
+    for (QChar ch : pattern) {
+        // Per-character folding keeps match offsets aligned with the source text
+        char16_t c = ch.toLower().unicode();
+        int next = m_nodes[state].next.value(c, -1);
+        if (next < 0) {
+            next = m_nodes.size();
+            m_nodes.append({{}, 0, -1, -1, m_nodes[state].depth + 1});
+            m_nodes[state].next.insert(c, next);
+        }
+        state = next;
+    }
+    
+    // The first pattern registered for a spelling wins
+    if (m_nodes[state].patternId < 0) {
+        m_nodes[state].patternId = patternId;
+        m_patternCount++;
+    }
+    m_built = false;
+}
+
+void AhoCorasick::build()
+{
+    // Breadth-first, so every fail target is final before it is used
+    QList<int> queue;
+    queue.reserve(m_nodes.size());
+    
+    for (auto it = m_nodes[0].next.constBegin(); it != m_nodes[0].next.constEnd(); ++it) {
+        m_nodes[it.value()].fail = 0;
+        m_nodes[it.value()].outputLink = -1;
+        queue.append(it.value());
+    }
+    
+    for (int head = 0; head < queue.size(); ++head) {
+        int node = queue[head];
+        for (auto it = m_nodes[node].next.constBegin(); it != m_nodes[node].next.constEnd(); ++it) {
+            char16_t c = it.key();
+            int child = it.value();
+            
+            int fail = m_nodes[node].fail;
+            while (fail != 0 && !m_nodes[fail].next.contains(c)) {
+                fail = m_nodes[fail].fail;
+            }
+            fail = m_nodes[fail].next.value(c, 0);
+            
+            m_nodes[child].fail = fail;
+            m_nodes[child].outputLink = (m_nodes[fail].patternId >= 0) ? fail : m_nodes[fail].outputLink;
+            queue.append(child);
+        }
+    }
+    
+    m_built = true;
+}
+
+QList<AhoCorasick::Match> AhoCorasick::findAll(const QString& text) const
+{
+    return findAll(text, 0, text.size());
+}
+
+QList<AhoCorasick::Match> AhoCorasick::findAll(const QString& text, int from, int to) const
+{
+    QList<Match> matches;
+    if (!m_built || m_patternCount == 0) {
+        return matches;
+    }
+    
+    from = qBound(0, from, text.size());
+    to = qBound(from, to, text.size());
+    
+    int state = 0;
+    for (int i = from; i < to; ++i) {
+        state = step(state, text[i].toLower().unicode());
+        
+        // Whole words only: the next character must not continue the word
+        if (i + 1 < text.size() && isWordChar(text[i + 1])) {
+            continue;
+        }
+        
+        int output = (m_nodes[state].patternId >= 0) ? state : m_nodes[state].outputLink;
+        while (output >= 0) {
+            const Node& node = m_nodes[output];
+            int start = i - node.depth + 1;
+            if (start >= from && (start == 0 || !isWordChar(text[start - 1]))) {
+                matches.append({start, node.depth, node.patternId});
+            }
+            output = node.outputLink;
+        }
+    }
+    
+    if (matches.size() < 2) {
+        return matches;
+    }
+    
+    // Keep leftmost-longest matches so "Anna Lee" is not also counted as "Anna"
+    std::sort(matches.begin(), matches.end(), [](const Match& a, const Match& b) {
+        return (a.position != b.position) ? a.position < b.position : a.length > b.length;
+    });
+    
+    QList<Match> filtered;
+    filtered.reserve(matches.size());
+    int coveredUntil = -1;
+    for (const Match& match : std::as_const(matches)) {
+        if (match.position >= coveredUntil) {
+            filtered.append(match);
+            coveredUntil = match.position + match.length;
+        }
+    }
+    
+    return filtered;
+}
+
+int AhoCorasick::step(int state, char16_t c) const
+{
+    while (state != 0 && !m_nodes[state].next.contains(c)) {
+        state = m_nodes[state].fail;
+    }
+    return m_nodes[state].next.value(c, 0);
+}
+
+bool AhoCorasick::isWordChar(QChar c)
+{
+    return c.isLetterOrNumber() || c == QLatin1Char('_');
+}
+
+qint64 AhoCorasick::estimateMemoryUsage() const
+{
+    // Each transition costs a hash entry; node headers are stored inline
+    qint64 bytes = static_cast<qint64>(m_nodes.capacity()) * sizeof(Node);
+    for (const Node& node : m_nodes) {
+        bytes += static_cast<qint64>(node.next.capacity()) * (sizeof(char16_t) + sizeof(int) + sizeof(void*));
+    }
+    
+    return bytes;
+}
@@ -0,0 +1,57 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef AHOCORASICK_H
+#define AHOCORASICK_H
+
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QHash>
+
+// Multi-pattern, case-insensitive whole-word matcher. All patterns are
+// found in a single linear pass over the text. Once built the automaton is
+// immutable, so one instance can be shared by any number of threads.
+class AhoCorasick
+{
+public:
+    struct Match {
+        int position;    // Offset of the first character in the scanned text
+        int length;
+        int patternId;   // Value supplied with the pattern in addPattern()
+    };
+
+    AhoCorasick();
+
+    // Construction
+    void addPattern(const QString& pattern, int patternId);
+    void build();
+    bool isEmpty() const { return m_patternCount == 0; }
+    int getPatternCount() const { return m_patternCount; }
+    qint64 estimateMemoryUsage() const;   // Rough heap footprint, for budgeting
+
+    // Matching
+    QList<Match> findAll(const QString& text) const;
+    QList<Match> findAll(const QString& text, int from, int to) const;
+
+private:
+    struct Node {
+        QHash<char16_t, int> next;
+        int fail;
+        int outputLink;    // Nearest node on the fail chain that ends a pattern
+        int patternId;     // -1 if no pattern ends here
+        int depth;
+    };
+
+    int step(int state, char16_t c) const;
+    static bool isWordChar(QChar c);
+
+    QList<Node> m_nodes;
+    int m_patternCount;
+    bool m_built;
+};
+
+#endif // AHOCORASICK_H
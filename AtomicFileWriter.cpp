@@ -0,0 +1,157 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "AtomicFileWriter.h"
+#include "TaskScheduler.h"
+#include <QSaveFile>
+#include <QDebug>
+#include <utility>
+
+AtomicFileWriter::AtomicFileWriter(QObject *parent)
+    : QObject(parent)
+    , m_debounceTimer(new CoalescedTimer(this))
+    , m_debounceInterval(DEFAULT_DEBOUNCE_INTERVAL)
+{
+    m_debounceTimer->setSingleShot(true);
+    connect(m_debounceTimer, &CoalescedTimer::timeout, this, &AtomicFileWriter::startPendingWrites);
+}
+
+AtomicFileWriter::~AtomicFileWriter()
+{
+    // Never drop data that callers were told would be written
+    waitForFinished();
+}
+
+void AtomicFileWriter::scheduleWrite(const QString& filePath, const QByteArray& data)
+{
+    if (filePath.isEmpty()) {
+        return;
+    }
+    
+    if (!m_debounceTimer->isActive()) {
+        m_windowOpened.start();
+    }
+    m_pending.insert(filePath, data);
+    
+    // Restart the debounce, but never past the window's deadline
+    const qint64 remaining = MAX_WRITE_LATENCY - m_windowOpened.elapsed();
+    if (remaining <= 0) {
+        flush();
+        return;
+    }
+    m_debounceTimer->start(static_cast<int>(qMin<qint64>(m_debounceInterval, remaining)));
+}
+
+void AtomicFileWriter::flush()
+{
+    m_debounceTimer->stop();
+    startPendingWrites();
+}
+
+void AtomicFileWriter::waitForFinished()
+{
+    m_debounceTimer->stop();
+    
+    // Let in-flight writes land first so newer data is never overwritten by older
+    const QStringList inFlightPaths = m_inFlight.keys();
+    for (const QString& filePath : inFlightPaths) {
+        m_inFlight.value(filePath)->waitForFinished();
+        finishWrite(filePath);
+    }
+    
+    // Whatever is still pending is written on the calling thread
+    const QHash<QString, QByteArray> pending = std::exchange(m_pending, {});
+    for (auto it = pending.constBegin(); it != pending.constEnd(); ++it) {
+        reportResult(writeFile(it.key(), it.value()));
+    }
+}
+
+void AtomicFileWriter::setDebounceInterval(int milliseconds)
+{
+    m_debounceInterval = qMax(0, milliseconds);
+}
+
+AtomicFileWriter::WriteResult AtomicFileWriter::writeFile(const QString& filePath, const QByteArray& data)
+{
+    WriteResult result;
+    result.filePath = filePath;
+    result.success = false;
+    
+    // QSaveFile writes to a temporary file and renames it over the target on
+    // commit, so readers only ever see the old or the new complete file
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        result.error = file.errorString();
+        return result;
+    }
+    
+    if (file.write(data) != data.size()) {
+        result.error = file.errorString();
+        file.cancelWriting();
+        return result;
+    }
+    
+    if (!file.commit()) {
+        result.error = file.errorString();
+        return result;
+    }
+    
+    result.success = true;
+    return result;
+}
+
+void AtomicFileWriter::startPendingWrites()
+{
+    const QStringList paths = m_pending.keys();
+    for (const QString& filePath : paths) {
+        // Paths with a write in flight are picked up again when it finishes
+        if (!m_inFlight.contains(filePath)) {
+            startWrite(filePath);
+        }
+    }
+}
+
+void AtomicFileWriter::startWrite(const QString& filePath)
+{
+    QByteArray data = m_pending.take(filePath);
+    
+    auto* watcher = new QFutureWatcher<WriteResult>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, filePath]() {
+        finishWrite(filePath);
+        if (m_pending.contains(filePath) && !m_debounceTimer->isActive()) {
+            startWrite(filePath);
+        }
+    });
+    
+    m_inFlight.insert(filePath, watcher);
+    watcher->setFuture(TaskScheduler::instance()->run(TaskScheduler::SaveLane, "save:" + filePath, [filePath, data]() {
+        return writeFile(filePath, data);
+    }));
+}
+
+void AtomicFileWriter::finishWrite(const QString& filePath)
+{
+    QFutureWatcher<WriteResult>* watcher = m_inFlight.take(filePath);
+    if (!watcher) {
+        return;
+    }
+    
+    disconnect(watcher, nullptr, this, nullptr);
+    WriteResult result = watcher->result();
+    watcher->deleteLater();
+    
+    reportResult(result);
+}
+
+void AtomicFileWriter::reportResult(const WriteResult& result)
+{
+    if (result.success) {
+        emit writeCompleted(result.filePath);
+    } else {
+        qDebug() << "Atomic write failed:" << result.filePath << result.error;
+        emit writeFailed(result.filePath, result.error);
+    }
+}
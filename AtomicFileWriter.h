@@ -0,0 +1,71 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef ATOMICFILEWRITER_H
+#define ATOMICFILEWRITER_H
+
+#include <QObject>
+#include <QHash>
+#include <QString>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include "TickService.h"
+
+// Writes files through QSaveFile on a worker thread. Writes scheduled for
+// the same path within the debounce window collapse into one (latest data
+// wins), and a path never has more than one write in flight. Steady typing
+// keeps restarting the debounce, so a window is flushed anyway once it has
+// been open for MAX_WRITE_LATENCY.
+class AtomicFileWriter : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct WriteResult {
+        QString filePath;
+        bool success;
+        QString error;
+    };
+
+    explicit AtomicFileWriter(QObject *parent = nullptr);
+    ~AtomicFileWriter();
+
+    // Write operations
+    void scheduleWrite(const QString& filePath, const QByteArray& data);
+    void flush();              // Start pending writes now instead of after the debounce
+    void waitForFinished();    // Block until every scheduled write is on disk
+
+    // Status
+    bool hasPendingWrites() const { return !m_pending.isEmpty() || !m_inFlight.isEmpty(); }
+    void setDebounceInterval(int milliseconds);
+
+    static WriteResult writeFile(const QString& filePath, const QByteArray& data);
+
+signals:
+    void writeCompleted(const QString& filePath);
+    void writeFailed(const QString& filePath, const QString& error);
+
+private slots:
+    void startPendingWrites();
+
+private:
+    void startWrite(const QString& filePath);
+    void finishWrite(const QString& filePath);
+    void reportResult(const WriteResult& result);
+
+    CoalescedTimer* m_debounceTimer;
+    int m_debounceInterval;
+    QElapsedTimer m_windowOpened;                                     // First write of the current debounce window
+    QHash<QString, QByteArray> m_pending;                             // Latest data per path
+    QHash<QString, QFutureWatcher<WriteResult>*> m_inFlight;          // One write per path
+
+    // Constants
+    static const int DEFAULT_DEBOUNCE_INTERVAL = 500;    // Milliseconds
+    static const int MAX_WRITE_LATENCY = 3000;           // Milliseconds a write may wait on the debounce
+};
+
+#endif // ATOMICFILEWRITER_H
@@ -6,24 +6,27 @@
 
 #include "AutoSaveManager.h"
 #include "EditorWidget.h"
+#include "DocumentStateService.h"
 #include <QDebug>
 #include <QStandardPaths>
 
 AutoSaveManager::AutoSaveManager(QObject *parent)
     : QObject(parent)
-    , m_autoSaveTimer(new QTimer(this))
-    , m_typingPauseTimer(new QTimer(this))
+    , m_autoSaveTimer(new CoalescedTimer(this))
+    , m_typingPauseTimer(new CoalescedTimer(this))
+    , m_documentState(nullptr)
     , m_intervalSeconds(DEFAULT_INTERVAL)
     , m_typingPauseSeconds(TYPING_PAUSE_INTERVAL)
     , m_enabled(true)
 {
     // Setup regular auto-save timer (fallback)
     m_autoSaveTimer->setSingleShot(false);
-    connect(m_autoSaveTimer, &QTimer::timeout, this, &AutoSaveManager::performAutoSave);
+    m_autoSaveTimer->setTimerType(Qt::VeryCoarseTimer); // A second late is harmless
+    connect(m_autoSaveTimer, &CoalescedTimer::timeout, this, &AutoSaveManager::performAutoSave);
     
     // Setup typing pause detection timer
     m_typingPauseTimer->setSingleShot(true);
-    connect(m_typingPauseTimer, &QTimer::timeout, this, &AutoSaveManager::onTypingPaused);
+    connect(m_typingPauseTimer, &CoalescedTimer::timeout, this, &AutoSaveManager::onTypingPaused);
     
     // Load settings
     loadSettings();
@@ -100,6 +103,22 @@ bool AutoSaveManager::isEnabled() const
     return m_enabled;
 }
 
+void AutoSaveManager::setDocumentStateService(DocumentStateService* service)
+{
+    if (m_documentState) {
+        disconnect(m_documentState, nullptr, this, nullptr);
+    }
+    
+    m_documentState = service;
+    
+    if (m_documentState) {
+        connect(m_documentState, &DocumentStateService::documentsEdited,
+                this, &AutoSaveManager::onDocumentsEdited);
+        connect(m_documentState, &DocumentStateService::dirtyStateChanged,
+                this, &AutoSaveManager::onDirtyStateChanged);
+    }
+}
+
 void AutoSaveManager::registerEditor(EditorWidget* editor, const QString& filePath)
 {
     if (!editor) {
@@ -114,8 +133,10 @@ void AutoSaveManager::registerEditor(EditorWidget* editor, const QString& filePa
     
     m_trackedEditors[editor] = info;
     
-    // Connect to editor signals for typing detection
-    connect(editor, &EditorWidget::contentChanged, this, &AutoSaveManager::onEditorModified);
+    // Typing detection comes coalesced from the state service when available
+    if (!m_documentState) {
+        connect(editor, &EditorWidget::contentChanged, this, &AutoSaveManager::onEditorModified);
+    }
     connect(editor, &QObject::destroyed, this, &AutoSaveManager::onEditorDestroyed);
     
     qDebug() << "Registered editor for auto-save:" << filePath;
@@ -258,16 +279,46 @@ void AutoSaveManager::onEditorModified()
     EditorWidget* editor = qobject_cast<EditorWidget*>(sender());
     if (editor && m_trackedEditors.contains(editor)) {
         m_trackedEditors[editor].hasUnsavedChanges = true;
-        
-        // Reset the typing pause timer every time the user types
-        // This creates the "countdown after stopping typing" behavior
-        m_typingPauseTimer->stop();
-        m_typingPauseTimer->start(m_typingPauseSeconds * 1000);
-        
-        qDebug() << "User typing detected, restarting" << m_typingPauseSeconds << "second countdown";
+        restartTypingPauseTimer();
     }
 }
 
+void AutoSaveManager::onDocumentsEdited(const QList<EditorWidget*>& editors)
+{
+    if (!m_enabled) {
+        return;
+    }
+    
+    bool trackedEdit = false;
+    for (EditorWidget* editor : editors) {
+        auto it = m_trackedEditors.find(editor);
+        if (it != m_trackedEditors.end()) {
+            it->hasUnsavedChanges = true;
+            trackedEdit = true;
+        }
+    }
+    
+    if (trackedEdit) {
+        restartTypingPauseTimer();
+    }
+}
+
+void AutoSaveManager::onDirtyStateChanged(EditorWidget* editor, bool dirty)
+{
+    // Keeps manual saves from being re-saved by the next auto-save pass
+    auto it = m_trackedEditors.find(editor);
+    if (it != m_trackedEditors.end()) {
+        it->hasUnsavedChanges = dirty;
+    }
+}
+
+void AutoSaveManager::restartTypingPauseTimer()
+{
+    // Reset the typing pause timer every time the user types
+    // This creates the "countdown after stopping typing" behavior
+    m_typingPauseTimer->start(m_typingPauseSeconds * 1000);
+}
+
 void AutoSaveManager::onTypingPaused()
 {
     if (!m_enabled) {
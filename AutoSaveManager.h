@@ -8,13 +8,15 @@
 #define AUTOSAVEMANAGER_H
 
 #include <QObject>
-#include <QTimer>
 #include <QHash>
+#include <QList>
 #include <QString>
 #include <QDateTime>
 #include <QSettings>
+#include "TickService.h"
 
 class EditorWidget;
+class DocumentStateService;
 
 class AutoSaveManager : public QObject
 {
@@ -32,6 +34,9 @@ public:
     void setEnabled(bool enabled);
     bool isEnabled() const;
     
+    // Dependencies
+    void setDocumentStateService(DocumentStateService* service);
+    
     // Editor management
     void registerEditor(EditorWidget* editor, const QString& filePath);
     void unregisterEditor(EditorWidget* editor);
@@ -55,7 +60,9 @@ signals:
 private slots:
     void performAutoSave();        // Regular interval-based save (fallback)
     void onTypingPaused();         // Triggered when user stops typing
-    void onEditorModified();       // Triggered when user types
+    void onEditorModified();       // Triggered when user types (no state service)
+    void onDocumentsEdited(const QList<EditorWidget*>& editors);  // Coalesced per frame
+    void onDirtyStateChanged(EditorWidget* editor, bool dirty);
     void onEditorDestroyed();
 
 private:
@@ -63,6 +70,7 @@ private:
     void saveSettings();
     bool needsSaving(EditorWidget* editor) const;
     void markAsSaved(EditorWidget* editor);
+    void restartTypingPauseTimer();
     
     struct EditorInfo {
         EditorWidget* editor;
@@ -71,9 +79,10 @@ private:
         bool hasUnsavedChanges;
     };
     
-    QTimer* m_autoSaveTimer;       // Regular interval timer (fallback)
-    QTimer* m_typingPauseTimer;    // Typing pause detection timer
+    CoalescedTimer* m_autoSaveTimer;       // Regular interval timer (fallback)
+    CoalescedTimer* m_typingPauseTimer;    // Typing pause detection timer
     QHash<EditorWidget*, EditorInfo> m_trackedEditors;
+    DocumentStateService* m_documentState;
     
     // Settings
     int m_intervalSeconds;         // Regular auto-save interval
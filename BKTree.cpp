@@ -0,0 +1,93 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "BKTree.h"
+#include <algorithm>
+
+BKTree::BKTree()
+{
+}
+
+void BKTree::insert(const QString& word)
+{
+    if (word.isEmpty()) {
+        return;
+    }
+    
+    QString key = word.toLower();
+    if (m_nodes.isEmpty()) {
+        m_nodes.append({key, word, {}});
+        return;
+    }
+    
+    int node = 0;
+    while (true) {
+        int d = distance(key, m_nodes[node].key);
+        if (d == 0) {
+            return;  // Already present
+        }
+        
+        int child = m_nodes[node].children.value(d, -1);
+        if (child < 0) {
+            m_nodes[node].children.insert(d, m_nodes.size());
+            m_nodes.append({key, word, {}});
+            return;
+        }
+        node = child;
+    }
+}
+
+QList<BKTree::Result> BKTree::search(const QString& word, int maxDistance) const
+{
+    QList<Result> results;
+    if (m_nodes.isEmpty() || word.isEmpty()) {
+        return results;
+    }
+    
+    QString key = word.toLower();
+    QList<int> pending{0};
+    while (!pending.isEmpty()) {
+        const Node& node = m_nodes[pending.takeLast()];
+        int d = distance(key, node.key);
+        if (d <= maxDistance) {
+            results.append({node.word, d});
+        }
+        
+        // Triangle inequality: only edges within maxDistance of d can match
+        for (auto it = node.children.constBegin(); it != node.children.constEnd(); ++it) {
+            if (it.key() >= d - maxDistance && it.key() <= d + maxDistance) {
+                pending.append(it.value());
+            }
+        }
+    }
+    
+    std::sort(results.begin(), results.end(), [](const Result& a, const Result& b) {
+        return a.distance < b.distance;
+    });
+    return results;
+}
+
+int BKTree::distance(const QString& a, const QString& b)
+{
+    // Two-row dynamic programming; names are short so this stays cheap
+    QList<int> previous(b.size() + 1);
+    QList<int> current(b.size() + 1);
+    for (int j = 0; j <= b.size(); ++j) {
+        previous[j] = j;
+    }
+    
+    for (int i = 1; i <= a.size(); ++i) {
+        current[0] = i;
+        QChar ca = a[i - 1].toLower();
+        for (int j = 1; j <= b.size(); ++j) {
+            int cost = (ca == b[j - 1].toLower()) ? 0 : 1;
+            current[j] = std::min({previous[j] + 1, current[j - 1] + 1, previous[j - 1] + cost});
+        }
+        std::swap(previous, current);
+    }
+    
+    return previous[b.size()];
+}
@@ -0,0 +1,45 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef BKTREE_H
+#define BKTREE_H
+
+#include <QString>
+#include <QList>
+#include <QHash>
+
+// Burkhard-Keller tree over words for case-insensitive fuzzy lookup. A
+// search within distance d only descends into children whose edge distance
+// lies within d of the query's distance to the node.
+class BKTree
+{
+public:
+    struct Result {
+        QString word;   // As inserted
+        int distance;
+    };
+
+    BKTree();
+
+    void insert(const QString& word);
+    QList<Result> search(const QString& word, int maxDistance) const;  // Closest first
+    bool isEmpty() const { return m_nodes.isEmpty(); }
+    int size() const { return m_nodes.size(); }
+
+    // Levenshtein distance with per-character case folding
+    static int distance(const QString& a, const QString& b);
+
+private:
+    struct Node {
+        QString key;                // Lower-cased
+        QString word;
+        QHash<int, int> children;   // Edge distance -> node index
+    };
+
+    QList<Node> m_nodes;
+};
+
+#endif // BKTREE_H
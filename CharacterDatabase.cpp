@@ -0,0 +1,331 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "CharacterDatabase.h"
+#include "AtomicFileWriter.h"
+#include "TaskScheduler.h"
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QUuid>
+#include <QDebug>
+
+CharacterDatabase::CharacterDatabase(AtomicFileWriter* writer, QObject *parent)
+    : QObject(parent)
+    , m_writer(writer)
+    , m_taskKey(QString("characters:matcher:%1").arg(reinterpret_cast<quintptr>(this), 0, 16))
+    , m_matcherWatcher(nullptr)
+    , m_matcherRebuildQueued(false)
+{
+}
+
+CharacterDatabase::~CharacterDatabase()
+{
+    if (m_matcherWatcher) {
+        m_matcherWatcher->waitForFinished();
+    }
+}
+
+bool CharacterDatabase::load(const QString& charactersPath)
+{
+    clear();
+    m_filePath = QDir(charactersPath).filePath("characters.json");
+    
+    QFile file(m_filePath);
+    if (!file.exists()) {
+        emit charactersChanged();
+        return true;
+    }
+    
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "Cannot open character file:" << m_filePath;
+        return false;
+    }
+    
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+    if (!doc.isObject()) {
+        qDebug() << "Invalid character file format:" << m_filePath;
+        return false;
+    }
+    
+    const QJsonArray characters = doc.object()["characters"].toArray();
+    m_characters.reserve(characters.size());
+    for (const auto& value : characters) {
+        QJsonObject object = value.toObject();
+        CharacterRecord record;
+        record.id = object["id"].toString();
+        record.name = object["name"].toString().trimmed();
+        record.notes = object["notes"].toString();
+        for (const auto& alias : object["aliases"].toArray()) {
+            QString trimmed = alias.toString().trimmed();
+            if (!trimmed.isEmpty()) {
+                record.aliases.append(trimmed);
+            }
+        }
+        
+        if (record.name.isEmpty()) {
+            continue;
+        }
+        if (record.id.isEmpty()) {
+            record.id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+        }
+        m_characters.append(record);
+    }
+    
+    rebuildLookup();
+    emit charactersChanged();
+    return true;
+}
+
+void CharacterDatabase::clear()
+{
+    m_filePath.clear();
+    m_characters.clear();
+    m_indexByName.clear();
+    startMatcherBuild();
+}
+
+QString CharacterDatabase::addCharacter(const QString& name, const QStringList& aliases)
+{
+    QString trimmed = name.trimmed();
+    if (trimmed.isEmpty()) {
+        return QString();
+    }
+    
+    // Adding an existing name is a no-op that returns the existing ID
+    QString existingId = findCharacterId(trimmed);
+    if (!existingId.isEmpty()) {
+        return existingId;
+    }
+    
+    CharacterRecord record;
+    record.id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+    record.name = trimmed;
+    record.aliases = aliases;
+    m_characters.append(record);
+    
+    rebuildLookup();
+    save();
+    emit charactersChanged();
+    return record.id;
+}
+
+bool CharacterDatabase::removeCharacter(const QString& id)
+{
+    int index = indexOfCharacter(id);
+    if (index < 0) {
+        return false;
+    }
+    
+    m_characters.removeAt(index);
+    
+    rebuildLookup();
+    save();
+    emit charactersChanged();
+    return true;
+}
+
+bool CharacterDatabase::renameCharacter(const QString& id, const QString& newName)
+{
+    int index = indexOfCharacter(id);
+    QString trimmed = newName.trimmed();
+    if (index < 0 || trimmed.isEmpty()) {
+        return false;
+    }
+    
+    m_characters[index].name = trimmed;
+    
+    rebuildLookup();
+    save();
+    emit charactersChanged();
+    return true;
+}
+
+bool CharacterDatabase::setAliases(const QString& id, const QStringList& aliases)
+{
+    int index = indexOfCharacter(id);
+    if (index < 0) {
+        return false;
+    }
+    
+    QStringList cleaned;
+    for (const QString& alias : aliases) {
+        QString trimmed = alias.trimmed();
+        if (!trimmed.isEmpty() && !cleaned.contains(trimmed, Qt::CaseInsensitive)) {
+            cleaned.append(trimmed);
+        }
+    }
+    m_characters[index].aliases = cleaned;
+    
+    rebuildLookup();
+    save();
+    emit charactersChanged();
+    return true;
+}
+
+QStringList CharacterDatabase::getCharacterNames() const
+{
+    QStringList names;
+    names.reserve(m_characters.size());
+    for (const CharacterRecord& record : m_characters) {
+        names.append(record.name);
+    }
+    
+    return names;
+}
+
+QStringList CharacterDatabase::getCharacterIds() const
+{
+    QStringList ids;
+    ids.reserve(m_characters.size());
+    for (const CharacterRecord& record : m_characters) {
+        ids.append(record.id);
+    }
+    
+    return ids;
+}
+
+CharacterRecord CharacterDatabase::getCharacter(const QString& id) const
+{
+    int index = indexOfCharacter(id);
+    return (index >= 0) ? m_characters[index] : CharacterRecord();
+}
+
+QString CharacterDatabase::findCharacterId(const QString& nameOrAlias) const
+{
+    int index = m_indexByName.value(nameOrAlias.trimmed().toLower(), -1);
+    return (index >= 0) ? m_characters[index].id : QString();
+}
+
+void CharacterDatabase::startMatcherBuild()
+{
+    // One build at a time; a change during a build queues exactly one more
+    if (m_matcherWatcher) {
+        m_matcherRebuildQueued = true;
+        return;
+    }
+    
+    m_matcherWatcher = new QFutureWatcher<std::shared_ptr<const CharacterMatcher>>(this);
+    connect(m_matcherWatcher, &QFutureWatcherBase::finished, this, &CharacterDatabase::onMatcherBuilt);
+    m_matcherWatcher->setFuture(TaskScheduler::instance()->run(TaskScheduler::IndexLane, m_taskKey,
+        [characters = m_characters]() { return buildMatcher(characters); }));
+}
+
+void CharacterDatabase::onMatcherBuilt()
+{
+    std::shared_ptr<const CharacterMatcher> matcher = m_matcherWatcher->result();
+    m_matcherWatcher->deleteLater();
+    m_matcherWatcher = nullptr;
+    
+    if (m_matcherRebuildQueued) {
+        m_matcherRebuildQueued = false;
+        startMatcherBuild();
+        return;
+    }
+    
+    // Swap on the GUI thread; holders of the previous snapshot keep it alive
+    m_matcher = matcher;
+    emit matcherChanged();
+}
+
+std::shared_ptr<const CharacterMatcher> CharacterDatabase::buildMatcher(const QList<CharacterRecord>& characters)
+{
+    auto matcher = std::make_shared<CharacterMatcher>();
+    matcher->characterIds.reserve(characters.size());
+    
+    for (int i = 0; i < characters.size(); ++i) {
+        matcher->characterIds.append(characters[i].id);
+        matcher->automaton.addPattern(characters[i].name, i);
+        for (const QString& alias : characters[i].aliases) {
+            matcher->automaton.addPattern(alias, i);
+        }
+    }
+    matcher->automaton.build();
+    
+    return matcher;
+}
+
+void CharacterDatabase::save()
+{
+    if (m_filePath.isEmpty() || !m_writer) {
+        return;
+    }
+    
+    QJsonArray characters;
+    for (const CharacterRecord& record : m_characters) {
+        QJsonObject object;
+        object["id"] = record.id;
+        object["name"] = record.name;
+        object["aliases"] = QJsonArray::fromStringList(record.aliases);
+        object["notes"] = record.notes;
+        characters.append(object);
+    }
+    
+    QJsonObject root;
+    root["characters"] = characters;
+    m_writer->scheduleWrite(m_filePath, QJsonDocument(root).toJson());
+}
+
+void CharacterDatabase::rebuildLookup()
+{
+    m_indexByName.clear();
+    for (int i = 0; i < m_characters.size(); ++i) {
+        m_indexByName.insert(m_characters[i].name.toLower(), i);
+        for (const QString& alias : m_characters[i].aliases) {
+            if (!m_indexByName.contains(alias.toLower())) {
+                m_indexByName.insert(alias.toLower(), i);
+            }
+        }
+    }
+    
+    startMatcherBuild();
+}
+
+qint64 CharacterDatabase::estimateMemoryUsage() const
+{
+    qint64 bytes = 0;
+    for (const CharacterRecord& record : m_characters) {
+        qint64 chars = record.id.size() + record.name.size() + record.notes.size();
+        for (const QString& alias : record.aliases) {
+            chars += alias.size();
+        }
+        bytes += sizeof(CharacterRecord) + chars * static_cast<qint64>(sizeof(QChar));
+    }
+    bytes += static_cast<qint64>(m_indexByName.size()) * (sizeof(QString) + sizeof(int) + sizeof(void*));
+    
+    if (m_matcher) {
+        bytes += m_matcher->automaton.estimateMemoryUsage();
+        bytes += static_cast<qint64>(m_matcher->characterIds.size()) * sizeof(QString);
+    }
+    
+    return bytes;
+}
+
+void CharacterDatabase::releaseMatcher()
+{
+    // Highlighters and scans that still hold the matcher keep it alive until done
+    m_matcher.reset();
+}
+
+void CharacterDatabase::ensureMatcher()
+{
+    if (!m_matcher && !m_matcherWatcher) {
+        startMatcherBuild();
+    }
+}
+
+int CharacterDatabase::indexOfCharacter(const QString& id) const
+{
+    for (int i = 0; i < m_characters.size(); ++i) {
+        if (m_characters[i].id == id) {
+            return i;
+        }
+    }
+    
+    return -1;
+}
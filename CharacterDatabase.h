@@ -0,0 +1,96 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef CHARACTERDATABASE_H
+#define CHARACTERDATABASE_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QHash>
+#include <QFutureWatcher>
+#include <memory>
+#include "AhoCorasick.h"
+
+class AtomicFileWriter;
+
+struct CharacterRecord {
+    QString id;            // Stable across renames
+    QString name;
+    QStringList aliases;   // Nicknames, titles, short forms
+    QString notes;
+};
+
+// Immutable snapshot shared by highlighters and scanners on any thread
+struct CharacterMatcher {
+    AhoCorasick automaton;
+    QStringList characterIds;   // Pattern ID -> character ID
+};
+
+// Project character store, persisted to characters/characters.json.
+// Also publishes the name/alias matcher used for highlighting and scanning;
+// it is rebuilt on a worker thread and swapped in whole when ready.
+class CharacterDatabase : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit CharacterDatabase(AtomicFileWriter* writer, QObject *parent = nullptr);
+    ~CharacterDatabase();
+
+    // Persistence
+    bool load(const QString& charactersPath);
+    void clear();
+
+    // Character operations
+    QString addCharacter(const QString& name, const QStringList& aliases = QStringList());
+    bool removeCharacter(const QString& id);
+    bool renameCharacter(const QString& id, const QString& newName);
+    bool setAliases(const QString& id, const QStringList& aliases);
+
+    // Queries
+    const QList<CharacterRecord>& getCharacters() const { return m_characters; }
+    QStringList getCharacterNames() const;
+    CharacterRecord getCharacter(const QString& id) const;
+    QString findCharacterId(const QString& nameOrAlias) const;
+    int count() const { return m_characters.size(); }
+
+    // Current matcher snapshot; null until the first build completes
+    std::shared_ptr<const CharacterMatcher> getMatcher() const { return m_matcher; }
+    
+    // Memory budgeting: the matcher can be dropped while the project is in the
+    // background and rebuilt when it is needed again
+    qint64 estimateMemoryUsage() const;
+    void releaseMatcher();
+    void ensureMatcher();
+    QStringList getCharacterIds() const;
+
+signals:
+    void charactersChanged();
+    void matcherChanged();
+
+private slots:
+    void onMatcherBuilt();
+
+private:
+    void save();
+    void rebuildLookup();
+    void startMatcherBuild();
+    int indexOfCharacter(const QString& id) const;
+    static std::shared_ptr<const CharacterMatcher> buildMatcher(const QList<CharacterRecord>& characters);
+
+    AtomicFileWriter* m_writer;
+    QString m_taskKey;   // Scheduler key; one per database so projects don't cancel each other
+    QString m_filePath;
+    QList<CharacterRecord> m_characters;
+    QHash<QString, int> m_indexByName;   // Lower-cased name or alias -> index
+    std::shared_ptr<const CharacterMatcher> m_matcher;
+    QFutureWatcher<std::shared_ptr<const CharacterMatcher>>* m_matcherWatcher;  // Non-null while building
+    bool m_matcherRebuildQueued;
+};
+
+#endif // CHARACTERDATABASE_H
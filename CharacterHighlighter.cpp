@@ -0,0 +1,41 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "CharacterHighlighter.h"
+#include "CharacterDatabase.h"
+#include <QColor>
+
+CharacterHighlighter::CharacterHighlighter(QTextDocument* document)
+    : QSyntaxHighlighter(document)
+{
+    // Underline only, so the author's own fonts and colours show through
+    m_nameFormat.setUnderlineStyle(QTextCharFormat::DotLine);
+    m_nameFormat.setUnderlineColor(QColor(70, 130, 180));
+}
+
+CharacterHighlighter::~CharacterHighlighter() = default;
+
+void CharacterHighlighter::setMatcher(std::shared_ptr<const CharacterMatcher> matcher)
+{
+    if (m_matcher == matcher) {
+        return;
+    }
+    
+    m_matcher = std::move(matcher);
+    rehighlight();
+}
+
+void CharacterHighlighter::highlightBlock(const QString& text)
+{
+    if (!m_matcher) {
+        return;
+    }
+    
+    const QList<AhoCorasick::Match> matches = m_matcher->automaton.findAll(text);
+    for (const AhoCorasick::Match& match : matches) {
+        setFormat(match.position, match.length, m_nameFormat);
+    }
+}
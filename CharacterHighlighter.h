@@ -0,0 +1,36 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef CHARACTERHIGHLIGHTER_H
+#define CHARACTERHIGHLIGHTER_H
+
+#include <QSyntaxHighlighter>
+#include <QTextCharFormat>
+#include <memory>
+
+struct CharacterMatcher;
+
+// Marks character names and aliases as they are typed. Only the edited
+// block is rescanned, in one linear pass over the shared matcher.
+class CharacterHighlighter : public QSyntaxHighlighter
+{
+    Q_OBJECT
+
+public:
+    explicit CharacterHighlighter(QTextDocument* document);
+    ~CharacterHighlighter();
+
+    void setMatcher(std::shared_ptr<const CharacterMatcher> matcher);
+
+protected:
+    void highlightBlock(const QString& text) override;
+
+private:
+    std::shared_ptr<const CharacterMatcher> m_matcher;  // Kept alive while in use
+    QTextCharFormat m_nameFormat;
+};
+
+#endif // CHARACTERHIGHLIGHTER_H
@@ -0,0 +1,229 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "CharacterMentionIndex.h"
+#include "CharacterDatabase.h"
+#include "TaskScheduler.h"
+#include <QFile>
+#include <QTextStream>
+#include <QDebug>
+#include <utility>
+
+CharacterMentionIndex::CharacterMentionIndex(QObject *parent)
+    : QObject(parent)
+    , m_database(nullptr)
+    , m_scan(this)
+    , m_rebuildQueued(false)
+{
+}
+
+CharacterMentionIndex::~CharacterMentionIndex() = default;
+
+void CharacterMentionIndex::setCharacterDatabase(CharacterDatabase* database)
+{
+    if (m_database) {
+        disconnect(m_database, nullptr, this, nullptr);
+    }
+    
+    m_database = database;
+    
+    if (m_database) {
+        // Name or alias edits change what counts as a mention; rescan once
+        // the new matcher has been swapped in
+        connect(m_database, &CharacterDatabase::matcherChanged, this, [this]() {
+            rebuild(m_chapterOrder);
+        });
+    }
+}
+
+void CharacterMentionIndex::rebuild(const QStringList& chapterPaths)
+{
+    m_chapterOrder = chapterPaths;
+    
+    // Only one scan runs at a time; the newest request runs when it ends
+    if (m_scan.isRunning()) {
+        m_rebuildQueued = true;
+        m_scan.cancel();
+        return;
+    }
+    
+    std::shared_ptr<const CharacterMatcher> matcher = m_database ? m_database->getMatcher() : nullptr;
+    if (!matcher || matcher->characterIds.isEmpty() || chapterPaths.isEmpty()) {
+        m_chapters.clear();
+        rebuildSummaries();
+        emit indexUpdated();
+        return;
+    }
+    
+    // Workers share one immutable matcher snapshot
+    m_scan.start(TaskScheduler::instance()->mapped(TaskScheduler::IndexLane, "mentions", chapterPaths,
+        [matcher](const QString& chapterPath) {
+            return scanFile(chapterPath, matcher);
+        }), [this]() { onScanFinished(); });
+}
+
+void CharacterMentionIndex::updateChapter(const QString& chapterPath, const QString& text)
+{
+    std::shared_ptr<const CharacterMatcher> matcher = m_database ? m_database->getMatcher() : nullptr;
+    if (!matcher || !m_chapterOrder.contains(chapterPath)) {
+        return;
+    }
+    
+    // A single chapter is cheap enough to rescan on the GUI thread
+    m_chapters.insert(chapterPath, scanText(chapterPath, text, *matcher));
+    rebuildSummaries();
+    emit indexUpdated();
+}
+
+void CharacterMentionIndex::clear()
+{
+    m_scan.stop();
+    m_rebuildQueued = false;
+    m_chapterOrder.clear();
+    m_chapters.clear();
+    m_summaries.clear();
+    emit indexUpdated();
+}
+
+CharacterMentionIndex::Results CharacterMentionIndex::takeResults()
+{
+    m_scan.stop();
+    m_rebuildQueued = false;
+    
+    Results results;
+    results.chapterOrder = std::exchange(m_chapterOrder, {});
+    results.chapters = std::exchange(m_chapters, {});
+    m_summaries.clear();
+    return results;
+}
+
+void CharacterMentionIndex::restoreResults(Results results)
+{
+    m_scan.stop();
+    m_rebuildQueued = false;
+    
+    // Summaries are cheap to derive again, so only the per-chapter stats are kept
+    m_chapterOrder = std::move(results.chapterOrder);
+    m_chapters = std::move(results.chapters);
+    rebuildSummaries();
+    emit indexUpdated();
+}
+
+qint64 CharacterMentionIndex::Results::estimateMemoryUsage() const
+{
+    // Character IDs are shared with the database; each stats entry costs a hash node
+    qint64 bytes = 0;
+    for (const ChapterMentions& mentions : chapters) {
+        bytes += sizeof(ChapterMentions) + mentions.chapterPath.size() * static_cast<qint64>(sizeof(QChar));
+        bytes += mentions.stats.size() * static_cast<qint64>(sizeof(QString) + sizeof(MentionStats) + sizeof(void*));
+    }
+    
+    return bytes;
+}
+
+int CharacterMentionIndex::getMentionCount(const QString& characterId) const
+{
+    return m_summaries.value(characterId).totalCount;
+}
+
+int CharacterMentionIndex::getMentionCount(const QString& characterId, const QString& chapterPath) const
+{
+    auto it = m_summaries.constFind(characterId);
+    return (it != m_summaries.constEnd()) ? it->chapterCounts.value(chapterPath, 0) : 0;
+}
+
+QHash<QString, int> CharacterMentionIndex::getChapterCounts(const QString& characterId) const
+{
+    return m_summaries.value(characterId).chapterCounts;
+}
+
+MentionLocation CharacterMentionIndex::getFirstAppearance(const QString& characterId) const
+{
+    return m_summaries.value(characterId).first;
+}
+
+MentionLocation CharacterMentionIndex::getLastAppearance(const QString& characterId) const
+{
+    return m_summaries.value(characterId).last;
+}
+
+CharacterMentionIndex::ChapterMentions CharacterMentionIndex::scanText(const QString& chapterPath, const QString& text,
+                                                                       const CharacterMatcher& matcher)
+{
+    ChapterMentions mentions;
+    mentions.chapterPath = chapterPath;
+    
+    const QList<AhoCorasick::Match> matches = matcher.automaton.findAll(text);
+    for (const AhoCorasick::Match& match : matches) {
+        const QString& characterId = matcher.characterIds.at(match.patternId);
+        MentionStats& stats = mentions.stats[characterId];
+        if (stats.count == 0) {
+            stats.firstPosition = match.position;
+        }
+        stats.lastPosition = match.position;
+        stats.count++;
+    }
+    
+    return mentions;
+}
+
+CharacterMentionIndex::ChapterMentions CharacterMentionIndex::scanFile(const QString& chapterPath,
+                                                                       const std::shared_ptr<const CharacterMatcher>& matcher)
+{
+    QFile file(chapterPath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qDebug() << "Cannot scan chapter for mentions:" << chapterPath;
+        ChapterMentions empty;
+        empty.chapterPath = chapterPath;
+        return empty;
+    }
+    
+    QTextStream in(&file);
+    return scanText(chapterPath, in.readAll(), *matcher);
+}
+
+void CharacterMentionIndex::onScanFinished()
+{
+    QFuture<ChapterMentions> future = m_scan.finish();
+    
+    if (m_rebuildQueued) {
+        m_rebuildQueued = false;
+        rebuild(m_chapterOrder);
+        return;
+    }
+    
+    m_chapters.clear();
+    const QList<ChapterMentions> results = future.results();
+    for (const ChapterMentions& mentions : results) {
+        m_chapters.insert(mentions.chapterPath, mentions);
+    }
+    
+    rebuildSummaries();
+    emit indexUpdated();
+}
+
+void CharacterMentionIndex::rebuildSummaries()
+{
+    m_summaries.clear();
+    
+    // Walk chapters in reading order so first/last appearances fall out directly
+    for (const QString& chapterPath : std::as_const(m_chapterOrder)) {
+        auto chapter = m_chapters.constFind(chapterPath);
+        if (chapter == m_chapters.constEnd()) {
+            continue;
+        }
+        
+        for (auto it = chapter->stats.constBegin(); it != chapter->stats.constEnd(); ++it) {
+            CharacterSummary& summary = m_summaries[it.key()];
+            summary.totalCount += it->count;
+            summary.chapterCounts.insert(chapterPath, it->count);
+            if (summary.first.chapterPath.isEmpty()) {
+                summary.first = {chapterPath, it->firstPosition};
+            }
+            summary.last = {chapterPath, it->lastPosition};
+        }
+    }
+}
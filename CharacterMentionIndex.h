@@ -0,0 +1,103 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef CHARACTERMENTIONINDEX_H
+#define CHARACTERMENTIONINDEX_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QList>
+#include <memory>
+#include "TaskWatcher.h"
+
+class CharacterDatabase;
+struct CharacterMatcher;
+
+struct MentionStats {
+    int count = 0;
+    int firstPosition = -1;   // Character offset within the chapter
+    int lastPosition = -1;
+};
+
+struct MentionLocation {
+    QString chapterPath;      // Empty if the character is never mentioned
+    int position = -1;
+};
+
+// Index of every character mention across the project's chapters. Chapters
+// are scanned in parallel with the database's matcher; afterwards counts
+// and first/last appearances are plain hash lookups.
+class CharacterMentionIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit CharacterMentionIndex(QObject *parent = nullptr);
+    ~CharacterMentionIndex();
+
+    void setCharacterDatabase(CharacterDatabase* database);
+
+    // Indexing
+    void rebuild(const QStringList& chapterPaths);   // Paths in reading order
+    void updateChapter(const QString& chapterPath, const QString& text);
+    void clear();
+    bool isIndexing() const { return m_scan.isRunning(); }
+
+    // Results of one project, parked while another project is active
+    struct Results;
+    Results takeResults();                  // Leaves the index empty
+    void restoreResults(Results results);   // Supersedes any running rebuild
+
+    // Queries
+    int getMentionCount(const QString& characterId) const;
+    int getMentionCount(const QString& characterId, const QString& chapterPath) const;
+    QHash<QString, int> getChapterCounts(const QString& characterId) const;
+    MentionLocation getFirstAppearance(const QString& characterId) const;
+    MentionLocation getLastAppearance(const QString& characterId) const;
+
+signals:
+    void indexUpdated();
+
+private slots:
+    void onScanFinished();
+
+private:
+    struct ChapterMentions {
+        QString chapterPath;
+        QHash<QString, MentionStats> stats;   // characterId -> stats
+    };
+
+    struct CharacterSummary {
+        int totalCount = 0;
+        QHash<QString, int> chapterCounts;
+        MentionLocation first;
+        MentionLocation last;
+    };
+
+    static ChapterMentions scanText(const QString& chapterPath, const QString& text,
+                                    const CharacterMatcher& matcher);
+    static ChapterMentions scanFile(const QString& chapterPath,
+                                    const std::shared_ptr<const CharacterMatcher>& matcher);
+    void rebuildSummaries();
+
+    CharacterDatabase* m_database;
+    QStringList m_chapterOrder;
+    QHash<QString, ChapterMentions> m_chapters;           // chapterPath -> mentions
+    QHash<QString, CharacterSummary> m_summaries;         // characterId -> summary
+    TaskWatcher<ChapterMentions> m_scan;                  // Running while a rebuild runs
+    bool m_rebuildQueued;
+};
+
+struct CharacterMentionIndex::Results {
+    QStringList chapterOrder;
+    QHash<QString, ChapterMentions> chapters;
+
+    qint64 estimateMemoryUsage() const;
+};
+
+#endif // CHARACTERMENTIONINDEX_H
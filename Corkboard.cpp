@@ -0,0 +1,194 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "Corkboard.h"
+#include "AtomicFileWriter.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QUuid>
+#include <QSet>
+#include <QDebug>
+
+const QColor Corkboard::DEFAULT_CARD_COLOR = QColor(255, 250, 220);
+
+Corkboard::Corkboard(AtomicFileWriter* writer, QObject *parent)
+    : QObject(parent)
+    , m_writer(writer)
+{
+}
+
+Corkboard::~Corkboard()
+{
+}
+
+bool Corkboard::load(const QString& filePath)
+{
+    m_filePath = filePath;
+    m_cards.clear();
+    m_indexById.clear();
+    
+    QFile file(m_filePath);
+    if (!file.exists()) {
+        return true;
+    }
+    
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "Cannot open corkboard file:" << m_filePath;
+        return false;
+    }
+    
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+    if (!doc.isObject()) {
+        qDebug() << "Invalid corkboard file format:" << m_filePath;
+        return false;
+    }
+    
+    const QJsonArray cards = doc.object()["cards"].toArray();
+    m_cards.reserve(cards.size());
+    for (const auto& value : cards) {
+        QJsonObject object = value.toObject();
+        CorkboardCard card;
+        card.id = object["id"].toString();
+        card.title = object["title"].toString();
+        card.synopsis = object["synopsis"].toString();
+        card.position = QPointF(object["x"].toDouble(), object["y"].toDouble());
+        card.color = QColor(object["color"].toString());
+        if (!card.color.isValid()) {
+            card.color = DEFAULT_CARD_COLOR;
+        }
+        if (card.id.isEmpty()) {
+            card.id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+        }
+        m_cards.append(card);
+    }
+    
+    rebuildIndex();
+    return true;
+}
+
+QString Corkboard::getName() const
+{
+    return QFileInfo(m_filePath).completeBaseName().replace('_', ' ');
+}
+
+QString Corkboard::addCard(const QString& title, const QPointF& position)
+{
+    CorkboardCard card;
+    card.id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+    card.title = title;
+    card.position = position;
+    card.color = DEFAULT_CARD_COLOR;
+    
+    m_indexById.insert(card.id, m_cards.size());
+    m_cards.append(card);
+    
+    save();
+    emit cardAdded(card.id);
+    return card.id;
+}
+
+bool Corkboard::updateCard(const CorkboardCard& card)
+{
+    int index = m_indexById.value(card.id, -1);
+    if (index < 0) {
+        return false;
+    }
+    
+    m_cards[index] = card;
+    
+    save();
+    emit cardChanged(card.id);
+    return true;
+}
+
+bool Corkboard::moveCards(const QHash<QString, QPointF>& positions)
+{
+    QStringList moved;
+    for (auto it = positions.constBegin(); it != positions.constEnd(); ++it) {
+        int index = m_indexById.value(it.key(), -1);
+        if (index >= 0 && m_cards[index].position != it.value()) {
+            m_cards[index].position = it.value();
+            moved.append(it.key());
+        }
+    }
+    
+    if (moved.isEmpty()) {
+        return false;
+    }
+    
+    // One write for the whole drag, however many cards moved
+    save();
+    for (const QString& id : std::as_const(moved)) {
+        emit cardChanged(id);
+    }
+    return true;
+}
+
+bool Corkboard::removeCards(const QStringList& ids)
+{
+    QSet<QString> removed;
+    for (const QString& id : ids) {
+        if (m_indexById.contains(id)) {
+            removed.insert(id);
+        }
+    }
+    
+    if (removed.isEmpty()) {
+        return false;
+    }
+    
+    m_cards.removeIf([&removed](const CorkboardCard& card) {
+        return removed.contains(card.id);
+    });
+    rebuildIndex();
+    
+    save();
+    for (const QString& id : std::as_const(removed)) {
+        emit cardRemoved(id);
+    }
+    return true;
+}
+
+CorkboardCard Corkboard::getCard(const QString& id) const
+{
+    int index = m_indexById.value(id, -1);
+    return (index >= 0) ? m_cards[index] : CorkboardCard();
+}
+
+void Corkboard::save()
+{
+    if (m_filePath.isEmpty() || !m_writer) {
+        return;
+    }
+    
+    QJsonArray cards;
+    for (const CorkboardCard& card : m_cards) {
+        QJsonObject object;
+        object["id"] = card.id;
+        object["title"] = card.title;
+        object["synopsis"] = card.synopsis;
+        object["x"] = card.position.x();
+        object["y"] = card.position.y();
+        object["color"] = card.color.name();
+        cards.append(object);
+    }
+    
+    QJsonObject root;
+    root["cards"] = cards;
+    m_writer->scheduleWrite(m_filePath, QJsonDocument(root).toJson(QJsonDocument::Compact));
+}
+
+void Corkboard::rebuildIndex()
+{
+    m_indexById.clear();
+    m_indexById.reserve(m_cards.size());
+    for (int i = 0; i < m_cards.size(); ++i) {
+        m_indexById.insert(m_cards[i].id, i);
+    }
+}
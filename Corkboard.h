@@ -0,0 +1,71 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef CORKBOARD_H
+#define CORKBOARD_H
+
+#include <QObject>
+#include <QString>
+#include <QList>
+#include <QHash>
+#include <QPointF>
+#include <QColor>
+#include <QPointer>
+
+class AtomicFileWriter;
+
+struct CorkboardCard {
+    QString id;
+    QString title;
+    QString synopsis;
+    QPointF position;   // Top-left corner in board coordinates
+    QColor color;
+};
+
+// One corkboard of scene cards, persisted as corkboard/<board>.json
+class Corkboard : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit Corkboard(AtomicFileWriter* writer, QObject *parent = nullptr);
+    ~Corkboard();
+
+    // Persistence
+    bool load(const QString& filePath);   // A missing file is an empty board
+    QString getFilePath() const { return m_filePath; }
+    QString getName() const;
+
+    // Card operations
+    QString addCard(const QString& title, const QPointF& position);
+    bool updateCard(const CorkboardCard& card);
+    bool moveCards(const QHash<QString, QPointF>& positions);
+    bool removeCards(const QStringList& ids);
+
+    // Queries
+    const QList<CorkboardCard>& getCards() const { return m_cards; }
+    CorkboardCard getCard(const QString& id) const;
+    int count() const { return m_cards.size(); }
+
+    // Constants
+    static const QColor DEFAULT_CARD_COLOR;
+
+signals:
+    void cardAdded(const QString& id);
+    void cardChanged(const QString& id);
+    void cardRemoved(const QString& id);
+
+private:
+    void save();
+    void rebuildIndex();
+
+    QPointer<AtomicFileWriter> m_writer;   // Owned by the project; null once it is closed
+    QString m_filePath;
+    QList<CorkboardCard> m_cards;
+    QHash<QString, int> m_indexById;   // Card ID -> index in m_cards
+};
+
+#endif // CORKBOARD_H
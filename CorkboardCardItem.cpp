@@ -0,0 +1,144 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "CorkboardCardItem.h"
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+#include <QFontMetrics>
+
+namespace {
+
+// Level-of-detail thresholds (screen pixels per scene unit)
+const qreal LOD_OUTLINE = 0.2;    // Below: flat colour block
+const qreal LOD_TITLE = 0.45;     // Below: outline only
+const qreal LOD_SYNOPSIS = 0.8;   // Below: title only
+
+// Built once; paint() runs for every visible card on every frame
+const QFont& titleFont()
+{
+    static const QFont font = []() {
+        QFont f;
+        f.setPointSize(10);
+        f.setBold(true);
+        return f;
+    }();
+    return font;
+}
+
+const QFont& synopsisFont()
+{
+    static const QFont font = []() {
+        QFont f;
+        f.setPointSize(9);
+        return f;
+    }();
+    return font;
+}
+
+int titleHeight()
+{
+    static const int height = QFontMetrics(titleFont()).height();
+    return height;
+}
+
+}
+
+CorkboardCardItem::CorkboardCardItem(const CorkboardCard& card)
+    : m_card(card)
+    , m_titleReady(false)
+    , m_synopsisReady(false)
+{
+    setFlags(ItemIsMovable | ItemIsSelectable);
+    setPos(card.position);
+}
+
+CorkboardCardItem::~CorkboardCardItem()
+{
+}
+
+void CorkboardCardItem::setCard(const CorkboardCard& card)
+{
+    if (card.title != m_card.title) {
+        m_titleReady = false;
+    }
+    if (card.synopsis != m_card.synopsis) {
+        m_synopsisReady = false;
+    }
+    
+    m_card = card;
+    setPos(card.position);
+    update();
+}
+
+QRectF CorkboardCardItem::boundingRect() const
+{
+    return QRectF(0, 0, CARD_WIDTH, CARD_HEIGHT);
+}
+
+void CorkboardCardItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    Q_UNUSED(widget)
+    
+    const QRectF rect = boundingRect();
+    const qreal lod = QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+    const bool selected = option->state & QStyle::State_Selected;
+    
+    // Far out a card is a few pixels wide; a flat block is all that reads
+    if (lod < LOD_OUTLINE) {
+        painter->fillRect(rect, selected ? m_card.color.darker(130) : m_card.color);
+        return;
+    }
+    
+    painter->setPen(selected ? QPen(QColor(40, 90, 160), 2) : QPen(m_card.color.darker(150)));
+    painter->setBrush(m_card.color);
+    painter->drawRect(rect);
+    
+    if (lod < LOD_TITLE) {
+        return;
+    }
+    
+    const QRectF contentRect = rect.adjusted(CARD_PADDING, CARD_PADDING, -CARD_PADDING, -CARD_PADDING);
+    if (!m_titleReady) {
+        prepareTitle();
+    }
+    painter->setPen(Qt::black);
+    painter->setFont(titleFont());
+    painter->drawText(QRectF(contentRect.topLeft(), QSizeF(contentRect.width(), titleHeight())),
+                      Qt::AlignLeft | Qt::AlignVCenter, m_elidedTitle);
+    
+    if (lod < LOD_SYNOPSIS || m_card.synopsis.isEmpty()) {
+        return;
+    }
+    
+    // Synopsis text is laid out the first time a card is seen close up
+    if (!m_synopsisReady) {
+        prepareSynopsis();
+    }
+    QRectF bodyRect = contentRect.adjusted(0, titleHeight() + 4, 0, 0);
+    painter->save();
+    painter->setClipRect(bodyRect);
+    painter->setPen(QColor(60, 60, 60));
+    painter->setFont(synopsisFont());
+    painter->drawStaticText(bodyRect.topLeft(), m_synopsisText);
+    painter->restore();
+}
+
+void CorkboardCardItem::prepareTitle()
+{
+    QFontMetrics metrics(titleFont());
+    QString title = m_card.title.isEmpty() ? QString("Untitled") : m_card.title;
+    m_elidedTitle = metrics.elidedText(title, Qt::ElideRight, CARD_WIDTH - 2 * CARD_PADDING);
+    m_titleReady = true;
+}
+
+void CorkboardCardItem::prepareSynopsis()
+{
+    m_synopsisText.setTextFormat(Qt::PlainText);
+    m_synopsisText.setTextWidth(CARD_WIDTH - 2 * CARD_PADDING);
+    m_synopsisText.setText(m_card.synopsis);
+    m_synopsisText.prepare(QTransform(), synopsisFont());
+    m_synopsisReady = true;
+}
@@ -0,0 +1,48 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef CORKBOARDCARDITEM_H
+#define CORKBOARDCARDITEM_H
+
+#include <QGraphicsItem>
+#include <QStaticText>
+#include "Corkboard.h"
+
+// Scene card that paints only as much detail as the zoom level can show.
+// Title eliding and synopsis layout are done on first use and cached.
+class CorkboardCardItem : public QGraphicsItem
+{
+public:
+    enum { Type = UserType + 1 };
+
+    explicit CorkboardCardItem(const CorkboardCard& card);
+    ~CorkboardCardItem();
+
+    void setCard(const CorkboardCard& card);
+    const CorkboardCard& getCard() const { return m_card; }
+    QString getCardId() const { return m_card.id; }
+
+    QRectF boundingRect() const override;
+    void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
+    int type() const override { return Type; }
+
+    // Constants
+    static const int CARD_WIDTH = 200;
+    static const int CARD_HEIGHT = 130;
+    static const int CARD_PADDING = 8;
+
+private:
+    void prepareTitle();
+    void prepareSynopsis();
+
+    CorkboardCard m_card;
+    QString m_elidedTitle;
+    QStaticText m_synopsisText;
+    bool m_titleReady;
+    bool m_synopsisReady;
+};
+
+#endif // CORKBOARDCARDITEM_H
@@ -0,0 +1,276 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "CorkboardView.h"
+#include "Corkboard.h"
+#include "CorkboardCardItem.h"
+#include <QWheelEvent>
+#include <QMouseEvent>
+#include <QKeyEvent>
+#include <QContextMenuEvent>
+#include <QScrollBar>
+#include <QMenu>
+#include <QInputDialog>
+#include <QColorDialog>
+#include <QPainter>
+#include <QtMath>
+
+CorkboardView::CorkboardView(Corkboard* board, QWidget *parent)
+    : QGraphicsView(parent)
+    , m_board(board)
+    , m_scene(new QGraphicsScene(this))
+    , m_panning(false)
+{
+    m_board->setParent(this);
+    
+    // BSP indexing makes itemAt() and exposed-item lookup logarithmic
+    m_scene->setItemIndexMethod(QGraphicsScene::BspTreeIndex);
+    setScene(m_scene);
+    
+    setDragMode(QGraphicsView::RubberBandDrag);
+    setTransformationAnchor(QGraphicsView::AnchorUnderMouse);
+    setViewportUpdateMode(QGraphicsView::SmartViewportUpdate);
+    setOptimizationFlag(QGraphicsView::DontAdjustForAntialiasing, true);
+    setCacheMode(QGraphicsView::CacheBackground);
+    
+    connect(m_board, &Corkboard::cardAdded, this, &CorkboardView::onCardAdded);
+    connect(m_board, &Corkboard::cardChanged, this, &CorkboardView::onCardChanged);
+    connect(m_board, &Corkboard::cardRemoved, this, &CorkboardView::onCardRemoved);
+    
+    populate();
+}
+
+CorkboardView::~CorkboardView()
+{
+}
+
+QString CorkboardView::getFilePath() const
+{
+    return m_board->getFilePath();
+}
+
+void CorkboardView::zoomBy(qreal factor)
+{
+    qreal current = transform().m11();
+    qreal target = qBound(MIN_SCALE, current * factor, MAX_SCALE);
+    if (!qFuzzyCompare(target, current)) {
+        scale(target / current, target / current);
+    }
+}
+
+void CorkboardView::populate()
+{
+    m_scene->clear();
+    m_items.clear();
+    
+    for (const CorkboardCard& card : m_board->getCards()) {
+        CorkboardCardItem* item = new CorkboardCardItem(card);
+        m_scene->addItem(item);
+        m_items.insert(card.id, item);
+    }
+}
+
+void CorkboardView::drawBackground(QPainter* painter, const QRectF& rect)
+{
+    painter->fillRect(rect, QColor(196, 160, 112));
+}
+
+void CorkboardView::wheelEvent(QWheelEvent* event)
+{
+    // Wheel zooms around the cursor; scrollbars and middle-drag pan
+    zoomBy(qPow(1.0015, event->angleDelta().y()));
+    event->accept();
+}
+
+void CorkboardView::mousePressEvent(QMouseEvent* event)
+{
+    if (event->button() == Qt::MiddleButton) {
+        m_panning = true;
+        m_lastPanPos = event->pos();
+        viewport()->setCursor(Qt::ClosedHandCursor);
+        event->accept();
+        return;
+    }
+    
+    QGraphicsView::mousePressEvent(event);
+}
+
+void CorkboardView::mouseMoveEvent(QMouseEvent* event)
+{
+    if (m_panning) {
+        QPoint delta = event->pos() - m_lastPanPos;
+        m_lastPanPos = event->pos();
+        horizontalScrollBar()->setValue(horizontalScrollBar()->value() - delta.x());
+        verticalScrollBar()->setValue(verticalScrollBar()->value() - delta.y());
+        event->accept();
+        return;
+    }
+    
+    QGraphicsView::mouseMoveEvent(event);
+}
+
+void CorkboardView::mouseReleaseEvent(QMouseEvent* event)
+{
+    if (m_panning && event->button() == Qt::MiddleButton) {
+        m_panning = false;
+        viewport()->unsetCursor();
+        event->accept();
+        return;
+    }
+    
+    QGraphicsView::mouseReleaseEvent(event);
+    
+    // Cards move freely while dragging; the board is written once on drop
+    if (event->button() == Qt::LeftButton) {
+        commitMovedCards();
+    }
+}
+
+void CorkboardView::mouseDoubleClickEvent(QMouseEvent* event)
+{
+    if (CorkboardCardItem* item = cardAt(event->pos())) {
+        editCard(item);
+        event->accept();
+        return;
+    }
+    
+    m_board->addCard("New Card", mapToScene(event->pos()));
+    event->accept();
+}
+
+void CorkboardView::keyPressEvent(QKeyEvent* event)
+{
+    if (event->key() == Qt::Key_Delete || event->key() == Qt::Key_Backspace) {
+        deleteSelectedCards();
+        event->accept();
+        return;
+    }
+    
+    QGraphicsView::keyPressEvent(event);
+}
+
+void CorkboardView::contextMenuEvent(QContextMenuEvent* event)
+{
+    CorkboardCardItem* item = cardAt(event->pos());
+    QPointF scenePos = mapToScene(event->pos());
+    
+    QMenu menu(this);
+    QAction* newAction = menu.addAction("New Card");
+    QAction* editAction = nullptr;
+    QAction* colorAction = nullptr;
+    QAction* deleteAction = nullptr;
+    if (item) {
+        if (!item->isSelected()) {
+            m_scene->clearSelection();
+            item->setSelected(true);
+        }
+        menu.addSeparator();
+        editAction = menu.addAction("Edit Card...");
+        colorAction = menu.addAction("Card Colour...");
+        deleteAction = menu.addAction("Delete");
+    }
+    
+    QAction* chosen = menu.exec(event->globalPos());
+    if (!chosen) {
+        return;
+    }
+    
+    if (chosen == newAction) {
+        m_board->addCard("New Card", scenePos);
+    } else if (chosen == editAction) {
+        editCard(item);
+    } else if (chosen == colorAction) {
+        QColor color = QColorDialog::getColor(item->getCard().color, this, "Card Colour");
+        if (color.isValid()) {
+            CorkboardCard card = item->getCard();
+            card.color = color;
+            m_board->updateCard(card);
+        }
+    } else if (chosen == deleteAction) {
+        deleteSelectedCards();
+    }
+}
+
+void CorkboardView::onCardAdded(const QString& id)
+{
+    CorkboardCardItem* item = new CorkboardCardItem(m_board->getCard(id));
+    m_scene->addItem(item);
+    m_items.insert(id, item);
+}
+
+void CorkboardView::onCardChanged(const QString& id)
+{
+    if (CorkboardCardItem* item = m_items.value(id, nullptr)) {
+        item->setCard(m_board->getCard(id));
+    }
+}
+
+void CorkboardView::onCardRemoved(const QString& id)
+{
+    if (CorkboardCardItem* item = m_items.take(id)) {
+        m_scene->removeItem(item);
+        delete item;
+    }
+}
+
+void CorkboardView::editCard(CorkboardCardItem* item)
+{
+    CorkboardCard card = item->getCard();
+    
+    bool ok = false;
+    QString title = QInputDialog::getText(this, "Edit Card", "Title:", QLineEdit::Normal, card.title, &ok);
+    if (!ok) {
+        return;
+    }
+    
+    QString synopsis = QInputDialog::getMultiLineText(this, "Edit Card", "Synopsis:", card.synopsis, &ok);
+    if (!ok) {
+        return;
+    }
+    
+    card.title = title.trimmed();
+    card.synopsis = synopsis;
+    m_board->updateCard(card);
+}
+
+void CorkboardView::deleteSelectedCards()
+{
+    QStringList ids;
+    const QList<QGraphicsItem*> selected = m_scene->selectedItems();
+    for (QGraphicsItem* item : selected) {
+        if (item->type() == CorkboardCardItem::Type) {
+            ids.append(static_cast<CorkboardCardItem*>(item)->getCardId());
+        }
+    }
+    
+    m_board->removeCards(ids);
+}
+
+void CorkboardView::commitMovedCards()
+{
+    QHash<QString, QPointF> positions;
+    const QList<QGraphicsItem*> selected = m_scene->selectedItems();
+    for (QGraphicsItem* item : selected) {
+        if (item->type() != CorkboardCardItem::Type) {
+            continue;
+        }
+        
+        CorkboardCardItem* card = static_cast<CorkboardCardItem*>(item);
+        if (card->pos() != card->getCard().position) {
+            positions.insert(card->getCardId(), card->pos());
+        }
+    }
+    
+    if (!positions.isEmpty()) {
+        m_board->moveCards(positions);
+    }
+}
+
+CorkboardCardItem* CorkboardView::cardAt(const QPoint& viewPos) const
+{
+    QGraphicsItem* item = itemAt(viewPos);
+    return (item && item->type() == CorkboardCardItem::Type) ? static_cast<CorkboardCardItem*>(item) : nullptr;
+}
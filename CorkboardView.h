@@ -0,0 +1,65 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef CORKBOARDVIEW_H
+#define CORKBOARDVIEW_H
+
+#include <QGraphicsView>
+#include <QGraphicsScene>
+#include <QHash>
+#include <QPoint>
+
+class Corkboard;
+class CorkboardCardItem;
+
+// Pan/zoom canvas for one corkboard. The scene's BSP index keeps hit-testing
+// and exposure culling cheap; cards scale their own detail with the zoom.
+class CorkboardView : public QGraphicsView
+{
+    Q_OBJECT
+
+public:
+    explicit CorkboardView(Corkboard* board, QWidget *parent = nullptr);  // Takes ownership of board
+    ~CorkboardView();
+
+    Corkboard* getBoard() const { return m_board; }
+    QString getFilePath() const;
+    void zoomBy(qreal factor);
+
+    // Constants
+    static constexpr qreal MIN_SCALE = 0.02;
+    static constexpr qreal MAX_SCALE = 4.0;
+
+protected:
+    void drawBackground(QPainter* painter, const QRectF& rect) override;
+    void wheelEvent(QWheelEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+    void mouseDoubleClickEvent(QMouseEvent* event) override;
+    void keyPressEvent(QKeyEvent* event) override;
+    void contextMenuEvent(QContextMenuEvent* event) override;
+
+private slots:
+    void onCardAdded(const QString& id);
+    void onCardChanged(const QString& id);
+    void onCardRemoved(const QString& id);
+
+private:
+    void populate();
+    void editCard(CorkboardCardItem* item);
+    void deleteSelectedCards();
+    void commitMovedCards();
+    CorkboardCardItem* cardAt(const QPoint& viewPos) const;
+
+    Corkboard* m_board;
+    QGraphicsScene* m_scene;
+    QHash<QString, CorkboardCardItem*> m_items;   // Card ID -> item
+    bool m_panning;
+    QPoint m_lastPanPos;
+};
+
+#endif // CORKBOARDVIEW_H
@@ -0,0 +1,192 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "DocumentRegistry.h"
+#include "EditorWidget.h"
+#include "DraggableTabWidget.h"
+#include "PaneManager.h"
+#include <QDebug>
+
+DocumentRegistry::DocumentRegistry(QObject *parent)
+    : QObject(parent)
+{
+}
+
+DocumentRegistry::~DocumentRegistry() = default;
+
+void DocumentRegistry::registerDocument(EditorWidget* editor, const QString& filePath, QWidget* container)
+{
+    if (!editor) {
+        return;
+    }
+    
+    // Re-registering an editor replaces its previous entry
+    if (m_documents.contains(editor)) {
+        m_editorsByPath.remove(m_documents[editor].filePath);
+    } else {
+        connect(editor, &QObject::destroyed, this, &DocumentRegistry::onEditorDestroyed);
+    }
+    
+    DocumentEntry entry;
+    entry.editor = editor;
+    entry.filePath = filePath;
+    entry.container = container;
+    entry.tabIndexHint = -1;
+    
+    m_documents[editor] = entry;
+    if (!filePath.isEmpty()) {
+        m_editorsByPath[filePath] = editor;
+    }
+    
+    emit documentRegistered(editor, filePath);
+}
+
+void DocumentRegistry::unregisterDocument(EditorWidget* editor)
+{
+    auto it = m_documents.find(editor);
+    if (it == m_documents.end()) {
+        return;
+    }
+    
+    QString filePath = it->filePath;
+    if (m_editorsByPath.value(filePath) == editor) {
+        m_editorsByPath.remove(filePath);
+    }
+    m_documents.erase(it);
+    disconnect(editor, &QObject::destroyed, this, &DocumentRegistry::onEditorDestroyed);
+    
+    emit documentUnregistered(editor, filePath);
+}
+
+void DocumentRegistry::updateFilePath(EditorWidget* editor, const QString& newPath)
+{
+    auto it = m_documents.find(editor);
+    if (it == m_documents.end()) {
+        return;
+    }
+    
+    QString oldPath = it->filePath;
+    if (oldPath == newPath) {
+        return;
+    }
+    
+    if (m_editorsByPath.value(oldPath) == editor) {
+        m_editorsByPath.remove(oldPath);
+    }
+    it->filePath = newPath;
+    if (!newPath.isEmpty()) {
+        m_editorsByPath[newPath] = editor;
+    }
+    
+    emit documentPathChanged(editor, oldPath, newPath);
+}
+
+void DocumentRegistry::updateContainer(QWidget* content, QWidget* container)
+{
+    EditorWidget* editor = qobject_cast<EditorWidget*>(content);
+    auto it = m_documents.find(editor);
+    if (it == m_documents.end()) {
+        return;
+    }
+    
+    it->container = container;
+    it->tabIndexHint = -1;
+    
+    emit documentMoved(editor, container);
+}
+
+EditorWidget* DocumentRegistry::editorForPath(const QString& filePath) const
+{
+    return m_editorsByPath.value(filePath, nullptr);
+}
+
+QString DocumentRegistry::pathForEditor(EditorWidget* editor) const
+{
+    auto it = m_documents.constFind(editor);
+    return (it != m_documents.constEnd()) ? it->filePath : QString();
+}
+
+QWidget* DocumentRegistry::containerForEditor(EditorWidget* editor) const
+{
+    auto it = m_documents.constFind(editor);
+    return (it != m_documents.constEnd()) ? it->container : nullptr;
+}
+
+int DocumentRegistry::tabIndexForEditor(EditorWidget* editor) const
+{
+    auto it = m_documents.constFind(editor);
+    if (it == m_documents.constEnd()) {
+        return -1;
+    }
+    
+    QTabWidget* tabWidget = qobject_cast<QTabWidget*>(it->container);
+    if (!tabWidget) {
+        return -1;
+    }
+    
+    // Tab indices only shift on structural changes, so the cached hint is
+    // almost always still valid and the lookup stays constant time
+    int hint = it->tabIndexHint;
+    if (hint >= 0 && hint < tabWidget->count() && tabWidget->widget(hint) == editor) {
+        return hint;
+    }
+    
+    it->tabIndexHint = tabWidget->indexOf(editor);
+    return it->tabIndexHint;
+}
+
+void DocumentRegistry::watchTabWidget(DraggableTabWidget* tabWidget)
+{
+    if (!tabWidget) {
+        return;
+    }
+    
+    connect(tabWidget, &DraggableTabWidget::tabContentInserted,
+            this, &DocumentRegistry::onTabContentInserted);
+}
+
+void DocumentRegistry::watchPaneManager(PaneManager* paneManager)
+{
+    if (!paneManager) {
+        return;
+    }
+    
+    connect(paneManager, &PaneManager::tabContentMoved, this,
+            [this](QWidget* content, QTabWidget* target) {
+                updateContainer(content, target);
+            });
+}
+
+void DocumentRegistry::onTabContentInserted(QWidget* content, int index)
+{
+    EditorWidget* editor = qobject_cast<EditorWidget*>(content);
+    auto it = m_documents.find(editor);
+    if (it == m_documents.end()) {
+        return;
+    }
+    
+    QTabWidget* tabWidget = qobject_cast<QTabWidget*>(sender());
+    it->tabIndexHint = index;
+    if (it->container != tabWidget) {
+        it->container = tabWidget;
+        emit documentMoved(editor, tabWidget);
+    }
+}
+
+void DocumentRegistry::onEditorDestroyed(QObject* object)
+{
+    // The object is mid-destruction, so only use the pointer as a key
+    EditorWidget* editor = static_cast<EditorWidget*>(object);
+    auto it = m_documents.find(editor);
+    if (it == m_documents.end()) {
+        return;
+    }
+    
+    if (m_editorsByPath.value(it->filePath) == editor) {
+        m_editorsByPath.remove(it->filePath);
+    }
+    m_documents.erase(it);
+}
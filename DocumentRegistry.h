@@ -0,0 +1,73 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef DOCUMENTREGISTRY_H
+#define DOCUMENTREGISTRY_H
+
+#include <QObject>
+#include <QHash>
+#include <QString>
+#include <QList>
+#include <QWidget>
+#include <QTabWidget>
+
+class EditorWidget;
+class DraggableTabWidget;
+class PaneManager;
+
+// Central index of open documents. Maps file path <-> editor <-> container
+// (tab widget or detached window) so lookups never scan tab widgets.
+class DocumentRegistry : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DocumentRegistry(QObject *parent = nullptr);
+    ~DocumentRegistry();
+
+    // Registration
+    void registerDocument(EditorWidget* editor, const QString& filePath, QWidget* container);
+    void unregisterDocument(EditorWidget* editor);
+    void updateFilePath(EditorWidget* editor, const QString& newPath);
+    void updateContainer(QWidget* content, QWidget* container);
+
+    // Lookups
+    bool contains(const QString& filePath) const { return m_editorsByPath.contains(filePath); }
+    bool contains(EditorWidget* editor) const { return m_documents.contains(editor); }
+    EditorWidget* editorForPath(const QString& filePath) const;
+    QString pathForEditor(EditorWidget* editor) const;
+    QWidget* containerForEditor(EditorWidget* editor) const;
+    int tabIndexForEditor(EditorWidget* editor) const;
+    QList<EditorWidget*> editors() const { return m_documents.keys(); }
+    int count() const { return m_documents.size(); }
+
+    // Container tracking
+    void watchTabWidget(DraggableTabWidget* tabWidget);
+    void watchPaneManager(PaneManager* paneManager);
+
+signals:
+    void documentRegistered(EditorWidget* editor, const QString& filePath);
+    void documentUnregistered(EditorWidget* editor, const QString& filePath);
+    void documentMoved(EditorWidget* editor, QWidget* container);
+    void documentPathChanged(EditorWidget* editor, const QString& oldPath, const QString& newPath);
+
+private slots:
+    void onTabContentInserted(QWidget* content, int index);
+    void onEditorDestroyed(QObject* object);
+
+private:
+    struct DocumentEntry {
+        EditorWidget* editor;
+        QString filePath;
+        QWidget* container;
+        mutable int tabIndexHint;  // Last known tab index, validated on read
+    };
+
+    QHash<EditorWidget*, DocumentEntry> m_documents;
+    QHash<QString, EditorWidget*> m_editorsByPath;
+};
+
+#endif // DOCUMENTREGISTRY_H
@@ -0,0 +1,95 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "DocumentStateService.h"
+#include "EditorWidget.h"
+
+DocumentStateService::DocumentStateService(QObject *parent)
+    : QObject(parent)
+    , m_frameTimer(new QTimer(this))
+{
+    m_frameTimer->setSingleShot(true);
+    m_frameTimer->setInterval(FRAME_INTERVAL);
+    connect(m_frameTimer, &QTimer::timeout, this, &DocumentStateService::flushEdits);
+}
+
+DocumentStateService::~DocumentStateService() = default;
+
+void DocumentStateService::watchEditor(EditorWidget* editor)
+{
+    if (!editor || m_watchedEditors.contains(editor)) {
+        return;
+    }
+    
+    m_watchedEditors.insert(editor);
+    if (editor->hasUnsavedChanges()) {
+        m_dirtyEditors.insert(editor);
+    }
+    
+    connect(editor, &EditorWidget::contentChanged, this, &DocumentStateService::onEditorContentChanged);
+    connect(editor, &EditorWidget::modificationChanged, this, &DocumentStateService::onEditorModificationChanged);
+    connect(editor, &QObject::destroyed, this, &DocumentStateService::onEditorDestroyed);
+}
+
+void DocumentStateService::unwatchEditor(EditorWidget* editor)
+{
+    if (!m_watchedEditors.remove(editor)) {
+        return;
+    }
+    
+    disconnect(editor, nullptr, this, nullptr);
+    m_dirtyEditors.remove(editor);
+    m_pendingEdits.remove(editor);
+}
+
+void DocumentStateService::onEditorContentChanged()
+{
+    // Hot path: runs on every keystroke, so only record and arm the timer
+    EditorWidget* editor = static_cast<EditorWidget*>(sender());
+    m_pendingEdits.insert(editor);
+    if (!m_frameTimer->isActive()) {
+        m_frameTimer->start();
+    }
+}
+
+void DocumentStateService::onEditorModificationChanged(bool modified)
+{
+    EditorWidget* editor = static_cast<EditorWidget*>(sender());
+    if (modified) {
+        m_dirtyEditors.insert(editor);
+    } else {
+        m_dirtyEditors.remove(editor);
+    }
+    
+    emit dirtyStateChanged(editor, modified);
+}
+
+void DocumentStateService::onEditorDestroyed(QObject* object)
+{
+    // The object is mid-destruction, so only use the pointer as a key
+    EditorWidget* editor = static_cast<EditorWidget*>(object);
+    m_watchedEditors.remove(editor);
+    m_dirtyEditors.remove(editor);
+    m_pendingEdits.remove(editor);
+}
+
+void DocumentStateService::flushEdits()
+{
+    QList<EditorWidget*> edited;
+    edited.reserve(m_pendingEdits.size());
+    
+    // Edits that were saved or reloaded within the same frame are no longer news
+    for (EditorWidget* editor : std::as_const(m_pendingEdits)) {
+        if (m_dirtyEditors.contains(editor)) {
+            edited.append(editor);
+        }
+    }
+    m_pendingEdits.clear();
+    
+    if (!edited.isEmpty()) {
+        emit documentsEdited(edited);
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef DOCUMENTSTATESERVICE_H
+#define DOCUMENTSTATESERVICE_H
+
+#include <QObject>
+#include <QTimer>
+#include <QSet>
+#include <QList>
+
+class EditorWidget;
+
+// Publishes document state changes at a bounded rate: dirty-state signals
+// only fire on clean<->dirty transitions, and per-keystroke edits are
+// coalesced into at most one "edited" tick per frame.
+class DocumentStateService : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DocumentStateService(QObject *parent = nullptr);
+    ~DocumentStateService();
+
+    // Editor management
+    void watchEditor(EditorWidget* editor);
+    void unwatchEditor(EditorWidget* editor);
+
+    // Status
+    bool isDirty(EditorWidget* editor) const { return m_dirtyEditors.contains(editor); }
+    int getDirtyCount() const { return m_dirtyEditors.size(); }
+
+signals:
+    void dirtyStateChanged(EditorWidget* editor, bool dirty);
+    void documentsEdited(const QList<EditorWidget*>& editors);
+
+private slots:
+    void onEditorContentChanged();
+    void onEditorModificationChanged(bool modified);
+    void onEditorDestroyed(QObject* object);
+    void flushEdits();
+
+private:
+    QTimer* m_frameTimer;
+    QSet<EditorWidget*> m_watchedEditors;
+    QSet<EditorWidget*> m_dirtyEditors;
+    QSet<EditorWidget*> m_pendingEdits;
+
+    // Constants
+    static const int FRAME_INTERVAL = 16;    // ~60 ticks per second at most
+};
+
+#endif // DOCUMENTSTATESERVICE_H
@@ -235,6 +235,14 @@ void DraggableTabWidget::moveTab(int fromIndex, int toIndex)
     emit tabReordered(fromIndex, toIndex);
 }
 
+void DraggableTabWidget::tabInserted(int index)
+{
+    QTabWidget::tabInserted(index);
+    
+    // Covers addTab, attachTab, moveTab and cross-widget drops alike
+    emit tabContentInserted(widget(index), index);
+}
+
 void DraggableTabWidget::dragEnterEvent(QDragEnterEvent* event)
 {
     if (m_dragEnabled && event->mimeData()->hasFormat("application/x-neurodraft-tab")) {
@@ -65,8 +65,10 @@ signals:
     void tabDetached(QWidget* widget, const QString& label, const QPoint& globalPos);
     void tabAttachRequested(QWidget* widget, const QString& label);
     void tabReordered(int fromIndex, int toIndex);
+    void tabContentInserted(QWidget* widget, int index);
 
 protected:
+    void tabInserted(int index) override;
     void dragEnterEvent(QDragEnterEvent* event) override;
     void dragMoveEvent(QDragMoveEvent* event) override;
     void dropEvent(QDropEvent* event) override;
@@ -5,10 +5,16 @@
  */
 
 #include "EditorWidget.h"
+#include "HeadingNumberOverlay.h"
+#include "CharacterHighlighter.h"
+#include "StyleLinter.h"
+#include "TaskScheduler.h"
+#include <QTextBlock>
 #include <QTextCursor>
 #include <QTextDocument>
 #include <QFile>
 #include <QFileInfo>
+#include <QSaveFile>
 #include <QTextStream>
 #include <QMessageBox>
 #include <QRegularExpression>
@@ -20,24 +26,38 @@
 #include <QTextList>
 #include <QTextTable>
 #include <QTextDocumentFragment>
+#include <QAbstractTextDocumentLayout>
+#include <QtMath>
+#include <QDebug>
 
 EditorWidget::EditorWidget(QWidget *parent)
     : QWidget(parent)
     , m_mainLayout(nullptr)
     , m_toolbar(nullptr)
     , m_textEditor(nullptr)
+    , m_plainEditor(nullptr)
+    , m_saveWatcher(nullptr)
     , m_statusLayout(nullptr)
     , m_wordCountLabel(nullptr)
     , m_characterCountLabel(nullptr)
     , m_targetLabel(nullptr)
+    , m_sentenceLabel(nullptr)
+    , m_readabilityLabel(nullptr)
     , m_filePathLabel(nullptr)
+    , m_headingOverlay(nullptr)
+    , m_characterHighlighter(nullptr)
+    , m_styleLinter(nullptr)
     , m_contextMenu(nullptr)
     , m_lookupAction(nullptr)
     , m_translateAction(nullptr)
     , m_hashtagAction(nullptr)
     , m_hasUnsavedChanges(false)
+    , m_settingContent(false)
+    , m_embedded(false)
+    , m_backgroundWorkPaused(false)
+    , m_statisticsStale(false)
     , m_wordTarget(0)
-    , m_updateTimer(new QTimer(this))
+    , m_updateTimer(new CoalescedTimer(this))
     , m_currentWordCount(0)
     , m_currentCharCount(0)
     , m_currentParagraphCount(0)
@@ -50,10 +70,19 @@ EditorWidget::EditorWidget(QWidget *parent)
     // Setup update timer for statistics
     m_updateTimer->setSingleShot(true);
     m_updateTimer->setInterval(500); // Update every 500ms after typing stops
-    connect(m_updateTimer, &QTimer::timeout, this, &EditorWidget::updateWordCount);
+    connect(m_updateTimer, &CoalescedTimer::timeout, this, &EditorWidget::updateWordCount);
 }
 
-EditorWidget::~EditorWidget() = default;
+EditorWidget::~EditorWidget()
+{
+    // Close paths call waitForSave() first; this only stops the snapshot outliving us
+    if (m_saveWatcher) {
+        m_saveWatcher->waitForFinished();
+        if (m_saveWatcher->isCanceled() || !m_saveWatcher->result()) {
+            qDebug() << "Editor destroyed after its save failed:" << m_filePath;
+        }
+    }
+}
 
 void EditorWidget::setupUI()
 {
@@ -212,6 +241,8 @@ void EditorWidget::setupStatusBar()
     m_wordCountLabel = new QLabel("Words: 0", this);
     m_characterCountLabel = new QLabel("Characters: 0", this);
     m_targetLabel = new QLabel("Target: Not set", this);
+    m_sentenceLabel = new QLabel("Sentences: 0", this);
+    m_readabilityLabel = new QLabel("Flesch: -", this);
     m_filePathLabel = new QLabel("Untitled", this);
     
     // Improved styling with better visibility
@@ -235,12 +266,16 @@ void EditorWidget::setupStatusBar()
     m_wordCountLabel->setStyleSheet(labelStyle);
     m_characterCountLabel->setStyleSheet(labelStyle);
     m_targetLabel->setStyleSheet(labelStyle);
+    m_sentenceLabel->setStyleSheet(labelStyle);
+    m_readabilityLabel->setStyleSheet(labelStyle);
     m_filePathLabel->setStyleSheet(filePathStyle);
     
     // Set minimum height for better visibility
     m_wordCountLabel->setMinimumHeight(24);
     m_characterCountLabel->setMinimumHeight(24);
     m_targetLabel->setMinimumHeight(24);
+    m_sentenceLabel->setMinimumHeight(24);
+    m_readabilityLabel->setMinimumHeight(24);
     m_filePathLabel->setMinimumHeight(24);
     
     // Create fresh status layout with better spacing
@@ -250,6 +285,8 @@ void EditorWidget::setupStatusBar()
     m_statusLayout->addWidget(m_wordCountLabel);
     m_statusLayout->addWidget(m_characterCountLabel);
     m_statusLayout->addWidget(m_targetLabel);
+    m_statusLayout->addWidget(m_sentenceLabel);
+    m_statusLayout->addWidget(m_readabilityLabel);
     m_statusLayout->addStretch();
     m_statusLayout->addWidget(m_filePathLabel);
     
@@ -268,14 +305,24 @@ void EditorWidget::setupStatusBar()
 
 void EditorWidget::setContent(const QString& content)
 {
-    m_textEditor->setPlainText(content);
-    m_hasUnsavedChanges = false;
+    m_settingContent = true;
+    if (m_plainEditor) {
+        m_plainEditor->setPlainText(content);
+        if (m_pieceTable) {
+            *m_pieceTable = PieceTable(content);
+        }
+    } else {
+        m_textEditor->setPlainText(content);
+    }
+    m_settingContent = false;
+    
+    setModified(false);
     updateWordCount();
 }
 
 QString EditorWidget::getContent() const
 {
-    return m_textEditor->toPlainText();
+    return activeDocument()->toPlainText();
 }
 
 bool EditorWidget::loadFromFile(const QString& filePath)
@@ -286,6 +333,19 @@ bool EditorWidget::loadFromFile(const QString& filePath)
         return false;
     }
     
+    // Rich text layout of multi-megabyte research dumps is too slow to edit
+    if (file.size() >= LARGE_FILE_THRESHOLD && !m_plainEditor) {
+        enterLargeFileMode();
+    }
+    
+    // Past this size even copying the document out to save it hurts, so a
+    // piece table follows every edit and saves are streamed from it
+    if (file.size() >= PIECE_TABLE_THRESHOLD && !m_pieceTable) {
+        m_pieceTable = std::make_unique<PieceTable>();
+        connect(m_plainEditor->document(), &QTextDocument::contentsChange,
+                this, &EditorWidget::onContentsChange);
+    }
+    
     QTextStream in(&file);
     QString content = in.readAll();
     
@@ -297,6 +357,10 @@ bool EditorWidget::loadFromFile(const QString& filePath)
 
 bool EditorWidget::saveToFile(const QString& filePath)
 {
+    if (m_pieceTable) {
+        return startPieceTableSave(filePath);
+    }
+    
     QFile file(filePath);
     if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
         QMessageBox::warning(this, "Error", "Cannot save file: " + filePath);
@@ -306,12 +370,68 @@ bool EditorWidget::saveToFile(const QString& filePath)
     QTextStream out(&file);
     out << getContent();
     
-    m_hasUnsavedChanges = false;
     setFilePath(filePath);
+    setModified(false);
+    
+    return true;
+}
+
+bool EditorWidget::startPieceTableSave(const QString& filePath)
+{
+    // Saves of one file must land in order; an overlapping save waits for the last
+    waitForSave();
+    
+    // Copying the table is an O(1) snapshot, so typing carries on while a
+    // worker streams it out; QSaveFile only replaces the file once complete
+    m_saveWatcher = new QFutureWatcher<bool>(this);
+    connect(m_saveWatcher, &QFutureWatcherBase::finished, this, &EditorWidget::onSaveFinished);
+    m_saveWatcher->setFuture(TaskScheduler::instance()->run(TaskScheduler::SaveLane, "editor:save:" + filePath,
+        [snapshot = PieceTable(*m_pieceTable), filePath]() {
+            QSaveFile file(filePath);
+            if (!file.open(QIODevice::WriteOnly) || !snapshot.writeTo(&file)) {
+                return false;
+            }
+            return file.commit();
+        }));
+    
+    // Edits made while the snapshot is written mark the editor dirty again
+    setFilePath(filePath);
+    setModified(false);
     
     return true;
 }
 
+bool EditorWidget::waitForSave()
+{
+    if (!m_saveWatcher) {
+        return true;
+    }
+    
+    // Handle the result now; the queued finished callout must not run afterwards
+    m_saveWatcher->waitForFinished();
+    disconnect(m_saveWatcher, nullptr, this, nullptr);
+    return onSaveFinished();
+}
+
+bool EditorWidget::onSaveFinished()
+{
+    if (!m_saveWatcher) {
+        return true;
+    }
+    
+    bool saved = !m_saveWatcher->isCanceled() && m_saveWatcher->result();
+    m_saveWatcher->deleteLater();
+    m_saveWatcher = nullptr;
+    
+    if (!saved) {
+        setModified(true);   // Keeps it in line for the next auto-save
+        QMessageBox::warning(this, "Error", "Cannot save file: " + m_filePath);
+    }
+    
+    emit saveFinished(saved);
+    return saved;
+}
+
 void EditorWidget::setFilePath(const QString& filePath)
 {
     m_filePath = filePath;
@@ -320,13 +440,18 @@ void EditorWidget::setFilePath(const QString& filePath)
         m_filePathLabel->setText("Untitled");
     } else {
         QFileInfo info(filePath);
-        m_filePathLabel->setText(info.fileName());
+        m_filePathLabel->setText(m_plainEditor ? info.fileName() + " (plain text)" : info.fileName());
     }
 }
 
 int EditorWidget::getWordCount() const
 {
-    QString text = m_textEditor->toPlainText();
+    // The block cache is current after every pass; copying out a large file is not
+    if (m_plainEditor) {
+        return m_statistics.totals.words;
+    }
+    
+    QString text = activeDocument()->toPlainText();
     if (text.isEmpty()) {
         return 0;
     }
@@ -339,12 +464,13 @@ int EditorWidget::getWordCount() const
 
 int EditorWidget::getCharacterCount() const
 {
-    return m_textEditor->toPlainText().length();
+    // Paragraph separators count like the newlines toPlainText() would return
+    return activeDocument()->characterCount() - 1;
 }
 
 int EditorWidget::getParagraphCount() const
 {
-    return m_textEditor->document()->blockCount();
+    return activeDocument()->blockCount();
 }
 
 void EditorWidget::setWordTarget(int target)
@@ -357,16 +483,24 @@ void EditorWidget::setFontSize(int size)
 {
     QFont font = m_textEditor->font();
     font.setPointSize(size);
-    m_textEditor->setFont(font);
+    setFont(font);
 }
 
 void EditorWidget::setFont(const QFont& font)
 {
     m_textEditor->setFont(font);
+    if (m_plainEditor) {
+        m_plainEditor->setFont(font);
+    }
 }
 
 void EditorWidget::setLineSpacing(double spacing)
 {
+    // The plain text layout ignores block line heights
+    if (m_plainEditor) {
+        return;
+    }
+    
     QTextCursor cursor = m_textEditor->textCursor();
     cursor.select(QTextCursor::Document);
     
@@ -375,6 +509,244 @@ void EditorWidget::setLineSpacing(double spacing)
     cursor.setBlockFormat(blockFormat);
 }
 
+void EditorWidget::setHeadingNumbering(int chapterNumber)
+{
+    if (m_plainEditor) {
+        return;
+    }
+    
+    if (!m_headingOverlay) {
+        if (chapterNumber <= 0) {
+            return;
+        }
+        m_headingOverlay = new HeadingNumberOverlay(m_textEditor);
+    }
+    
+    m_headingOverlay->setChapterNumber(chapterNumber);
+}
+
+void EditorWidget::setCharacterMatcher(std::shared_ptr<const CharacterMatcher> matcher)
+{
+    // Every matcher swap rehighlights the whole document, too slow for large files
+    if (m_plainEditor) {
+        return;
+    }
+    
+    if (!m_characterHighlighter) {
+        if (!matcher) {
+            return;
+        }
+        m_characterHighlighter = new CharacterHighlighter(m_textEditor->document());
+    }
+    
+    m_characterHighlighter->setMatcher(std::move(matcher));
+}
+
+void EditorWidget::setStyleRules(std::shared_ptr<const StyleRuleSet> ruleSet)
+{
+    if (!m_styleLinter) {
+        if (!ruleSet) {
+            return;
+        }
+        m_styleLinter = new StyleLinter(activeDocument(), this);
+        m_styleLinter->setPaused(m_backgroundWorkPaused);
+        connect(m_styleLinter, &StyleLinter::marksChanged, this, [this](const QList<QTextEdit::ExtraSelection>& marks) {
+            setMarkLayer("style", marks);
+        });
+    }
+    
+    m_styleLinter->setRuleSet(std::move(ruleSet));
+}
+
+void EditorWidget::setEmbedded(bool embedded)
+{
+    if (m_embedded == embedded) {
+        return;
+    }
+    m_embedded = embedded;
+    
+    m_toolbar->setVisible(!embedded && !m_plainEditor);
+    for (QLabel* label : {m_wordCountLabel, m_characterCountLabel, m_targetLabel,
+                          m_sentenceLabel, m_readabilityLabel, m_filePathLabel}) {
+        label->setVisible(!embedded);
+    }
+    
+    // Large files keep their own scroll bar; fitting them would lay out everything
+    if (m_plainEditor) {
+        return;
+    }
+    
+    // The surrounding view scrolls; the editor just takes the document's height
+    m_textEditor->setVerticalScrollBarPolicy(embedded ? Qt::ScrollBarAlwaysOff : Qt::ScrollBarAsNeeded);
+    if (embedded) {
+        m_fitConnection = connect(m_textEditor->document()->documentLayout(),
+                                  &QAbstractTextDocumentLayout::documentSizeChanged,
+                                  this, &EditorWidget::fitToDocument);
+        fitToDocument();
+    } else {
+        disconnect(m_fitConnection);
+        m_textEditor->setMinimumHeight(0);
+        m_textEditor->setMaximumHeight(QWIDGETSIZE_MAX);
+    }
+}
+
+void EditorWidget::setBackgroundWorkPaused(bool paused)
+{
+    if (m_backgroundWorkPaused == paused) {
+        return;
+    }
+    m_backgroundWorkPaused = paused;
+    
+    if (m_styleLinter) {
+        m_styleLinter->setPaused(paused);
+    }
+    
+    // A pending update is carried over; on resume it runs once after the usual delay
+    if (paused) {
+        if (m_updateTimer->isActive()) {
+            m_updateTimer->stop();
+            m_statisticsStale = true;
+        }
+    } else if (m_statisticsStale) {
+        m_statisticsStale = false;
+        m_updateTimer->start();
+    }
+}
+
+void EditorWidget::fitToDocument()
+{
+    int frame = m_textEditor->frameWidth() * 2;
+    int height = qCeil(m_textEditor->document()->size().height()) + frame;
+    if (m_textEditor->height() != height) {
+        m_textEditor->setFixedHeight(height);
+    }
+}
+
+void EditorWidget::enterLargeFileMode()
+{
+    // Block layout only measures lines near the viewport, so opening and
+    // scrolling stay fast no matter how long the file is
+    m_plainEditor = new QPlainTextEdit(this);
+    m_plainEditor->setFont(m_textEditor->font());
+    m_plainEditor->setLineWrapMode(QPlainTextEdit::WidgetWidth);
+    m_plainEditor->setContextMenuPolicy(Qt::CustomContextMenu);
+    m_mainLayout->replaceWidget(m_textEditor, m_plainEditor);
+    
+    connect(m_plainEditor, &QPlainTextEdit::textChanged, this, &EditorWidget::onTextChanged);
+    connect(m_plainEditor, &QPlainTextEdit::cursorPositionChanged, this, &EditorWidget::onCursorPositionChanged);
+    connect(m_plainEditor, &QPlainTextEdit::customContextMenuRequested,
+            this, &EditorWidget::showContextMenu);
+    
+    // Rich text tools and the helpers bound to the old document go away
+    m_toolbar->hide();
+    m_textEditor->hide();
+    m_textEditor->clear();
+    delete m_headingOverlay;
+    m_headingOverlay = nullptr;
+    delete m_characterHighlighter;
+    m_characterHighlighter = nullptr;
+    delete m_styleLinter;
+    m_styleLinter = nullptr;
+    m_markLayers.clear();
+}
+
+QTextDocument* EditorWidget::activeDocument() const
+{
+    return m_plainEditor ? m_plainEditor->document() : m_textEditor->document();
+}
+
+QAbstractScrollArea* EditorWidget::activeEditor() const
+{
+    if (m_plainEditor) {
+        return m_plainEditor;
+    }
+    return m_textEditor;
+}
+
+QTextCursor EditorWidget::activeCursor() const
+{
+    return m_plainEditor ? m_plainEditor->textCursor() : m_textEditor->textCursor();
+}
+
+void EditorWidget::setActiveCursor(const QTextCursor& cursor)
+{
+    if (m_plainEditor) {
+        m_plainEditor->setTextCursor(cursor);
+        m_plainEditor->ensureCursorVisible();
+    } else {
+        m_textEditor->setTextCursor(cursor);
+        m_textEditor->ensureCursorVisible();
+    }
+}
+
+void EditorWidget::setMarkedRanges(const QString& layer, const QList<QPair<int, int>>& ranges, const QTextCharFormat& format)
+{
+    QList<QTextEdit::ExtraSelection> selections;
+    selections.reserve(ranges.size());
+    
+    int documentEnd = activeDocument()->characterCount() - 1;
+    for (const auto& range : ranges) {
+        if (range.first < 0 || range.first + range.second > documentEnd) {
+            continue;  // Stale range from an older revision of the text
+        }
+        
+        QTextEdit::ExtraSelection selection;
+        selection.cursor = QTextCursor(activeDocument());
+        selection.cursor.setPosition(range.first);
+        selection.cursor.setPosition(range.first + range.second, QTextCursor::KeepAnchor);
+        selection.format = format;
+        selections.append(selection);
+    }
+    
+    setMarkLayer(layer, selections);
+}
+
+void EditorWidget::setMarkLayer(const QString& layer, const QList<QTextEdit::ExtraSelection>& selections)
+{
+    if (selections.isEmpty()) {
+        if (m_markLayers.remove(layer) == 0) {
+            return;
+        }
+    } else {
+        m_markLayers.insert(layer, selections);
+    }
+    applyMarkedRanges();
+}
+
+void EditorWidget::clearMarkedRanges(const QString& layer)
+{
+    if (m_markLayers.remove(layer) > 0) {
+        applyMarkedRanges();
+    }
+}
+
+void EditorWidget::goToPosition(int position, int length)
+{
+    QTextCursor cursor(activeDocument());
+    int documentEnd = activeDocument()->characterCount() - 1;
+    cursor.setPosition(qBound(0, position, documentEnd));
+    if (length > 0) {
+        cursor.setPosition(qBound(0, position + length, documentEnd), QTextCursor::KeepAnchor);
+    }
+    
+    setActiveCursor(cursor);
+    activeEditor()->setFocus();
+}
+
+void EditorWidget::applyMarkedRanges()
+{
+    QList<QTextEdit::ExtraSelection> selections;
+    for (auto it = m_markLayers.constBegin(); it != m_markLayers.constEnd(); ++it) {
+        selections.append(it.value());
+    }
+    
+    if (m_plainEditor) {
+        m_plainEditor->setExtraSelections(selections);
+    } else {
+        m_textEditor->setExtraSelections(selections);
+    }
+}
+
 // Rich text formatting methods
 void EditorWidget::setBold(bool bold)
 {
@@ -521,25 +893,79 @@ Qt::Alignment EditorWidget::alignment() const
 
 void EditorWidget::onTextChanged()
 {
-    m_hasUnsavedChanges = true;
-    m_updateTimer->start(); // Restart timer for delayed update
+    // Highlighter passes also emit textChanged but never touch the undo
+    // stack, so the document's own modified flag filters them out
+    if (m_settingContent || !activeDocument()->isModified()) {
+        return;
+    }
+    
+    setModified(true);
+    if (m_backgroundWorkPaused) {
+        m_statisticsStale = true;
+    } else {
+        m_updateTimer->start(); // Restart timer for delayed update
+    }
     emit contentChanged();
 }
 
+void EditorWidget::setModified(bool modified)
+{
+    if (!modified) {
+        activeDocument()->setModified(false);
+    }
+    
+    if (m_hasUnsavedChanges == modified) {
+        return;
+    }
+    
+    m_hasUnsavedChanges = modified;
+    emit modificationChanged(modified);
+}
+
 void EditorWidget::updateWordCount()
 {
-    m_currentWordCount = getWordCount();
+    // Block statistics count words the same way getWordCount() does
+    updateStatistics();
+    m_currentWordCount = m_statistics.totals.words;
     m_currentCharCount = getCharacterCount();
     m_currentParagraphCount = getParagraphCount();
     
     updateStatusBar();
     emit wordCountChanged(m_currentWordCount);
+    emit statisticsChanged();
+}
+
+void EditorWidget::updateStatistics()
+{
+    DocumentStatistics statistics;
+    
+    // Only blocks whose revision moved since the last pass are re-analyzed
+    for (QTextBlock block = activeDocument()->begin(); block.isValid(); block = block.next()) {
+        auto* cached = dynamic_cast<StatisticsBlockData*>(block.userData());
+        if (!cached || cached->getRevision() != block.revision()) {
+            cached = new StatisticsBlockData(block.revision(), TextStatistics::analyzeBlock(block.text()));
+            block.setUserData(cached);  // Takes ownership, deleting the stale entry
+        }
+        
+        statistics.totals += cached->getStatistics();
+        if (cached->getStatistics().words > 0) {
+            statistics.paragraphs++;
+        }
+    }
+    
+    m_statistics = statistics;
 }
 
 void EditorWidget::updateStatusBar()
 {
     m_wordCountLabel->setText(QString("Words: %1").arg(m_currentWordCount));
     m_characterCountLabel->setText(QString("Characters: %1").arg(m_currentCharCount));
+    m_sentenceLabel->setText(QString("Sentences: %1 (avg %2)")
+                             .arg(m_statistics.totals.sentences)
+                             .arg(QString::number(m_statistics.averageSentenceLength(), 'f', 1)));
+    m_readabilityLabel->setText(m_statistics.totals.sentences > 0
+                                ? QString("Flesch: %1").arg(QString::number(m_statistics.fleschReadingEase(), 'f', 0))
+                                : QString("Flesch: -"));
     
     if (m_wordTarget > 0) {
         double percentage = (double)m_currentWordCount / m_wordTarget * 100.0;
@@ -580,7 +1006,7 @@ void EditorWidget::showContextMenu(const QPoint& pos)
         m_translateAction->setText("Translate word");
     }
     
-    m_contextMenu->exec(m_textEditor->mapToGlobal(pos));
+    m_contextMenu->exec(activeEditor()->mapToGlobal(pos));
 }
 
 void EditorWidget::lookupWord()
@@ -614,7 +1040,7 @@ void EditorWidget::addHashtag()
             hashtag = '#' + hashtag;
         }
         
-        QTextCursor cursor = m_textEditor->textCursor();
+        QTextCursor cursor = activeCursor();
         cursor.insertText(hashtag + " ");
         
         emit hashtagClicked(hashtag);
@@ -625,6 +1051,38 @@ void EditorWidget::onCursorPositionChanged()
 {
     updateFormattingButtons();
     emit formattingChanged();
+    
+    if (m_embedded) {
+        QRect rect = m_plainEditor ? m_plainEditor->cursorRect() : m_textEditor->cursorRect();
+        emit cursorRectChanged(rect.translated(activeEditor()->viewport()->mapTo(this, QPoint(0, 0))));
+    }
+}
+
+void EditorWidget::onContentsChange(int position, int charsRemoved, int charsAdded)
+{
+    if (m_settingContent || !m_pieceTable) {
+        return;
+    }
+    
+    // Qt may over-report a change by the same amount on both sides (e.g.
+    // edits in the first block), so clamp to what the document really holds
+    QTextDocument* document = m_plainEditor->document();
+    int documentLength = document->characterCount() - 1;
+    int added = qBound(0, charsAdded, documentLength - position);
+    int removed = qMax(0, charsRemoved - (charsAdded - added));
+    
+    m_pieceTable->remove(position, removed);
+    if (added > 0) {
+        QTextCursor cursor(document);
+        cursor.setPosition(position);
+        cursor.setPosition(position + added, QTextCursor::KeepAnchor);
+        m_pieceTable->insert(position, cursor.selectedText().replace(QChar::ParagraphSeparator, QLatin1Char('\n')));
+    }
+    
+    if (m_pieceTable->length() != documentLength) {
+        qDebug() << "Piece table out of sync, rebuilding:" << m_filePath;
+        *m_pieceTable = PieceTable(document->toPlainText());
+    }
 }
 
 void EditorWidget::updateFormattingButtons()
@@ -647,7 +1105,7 @@ void EditorWidget::updateFormattingButtons()
 
 QString EditorWidget::getSelectedWord() const
 {
-    QTextCursor cursor = m_textEditor->textCursor();
+    QTextCursor cursor = activeCursor();
     
     if (cursor.hasSelection()) {
         return cursor.selectedText();
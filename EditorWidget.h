@@ -8,16 +8,29 @@
 #define EDITORWIDGET_H
 
 #include <QTextEdit>
+#include <QPlainTextEdit>
 #include <QWidget>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QLabel>
-#include <QTimer>
 #include <QString>
 #include <QContextMenuEvent>
 #include <QMenu>
 #include <QAction>
 #include <QToolBar>
+#include <QHash>
+#include <QPair>
+#include <QFutureWatcher>
+#include <memory>
+#include "TextStatistics.h"
+#include "PieceTable.h"
+#include "TickService.h"
+
+class HeadingNumberOverlay;
+class CharacterHighlighter;
+class StyleLinter;
+class StyleRuleSet;
+struct CharacterMatcher;
 
 class EditorWidget : public QWidget
 {
@@ -34,7 +47,9 @@ public:
     
     // File operations
     bool loadFromFile(const QString& filePath);
-    bool saveToFile(const QString& filePath);
+    bool saveToFile(const QString& filePath);  // Large files return once the write is queued
+    bool isSaving() const { return m_saveWatcher != nullptr; }
+    bool waitForSave();  // Blocks until a queued write lands; false (and warns) if it failed
     void setFilePath(const QString& filePath);
     QString getFilePath() const { return m_filePath; }
     
@@ -42,6 +57,7 @@ public:
     int getWordCount() const;
     int getCharacterCount() const;
     int getParagraphCount() const;
+    const DocumentStatistics& getStatistics() const { return m_statistics; }
     
     // Word count targets
     void setWordTarget(int target);
@@ -51,6 +67,20 @@ public:
     void setFontSize(int size);
     void setFont(const QFont& font);
     void setLineSpacing(double spacing);
+    void setHeadingNumbering(int chapterNumber);  // 0 hides computed heading numbers
+    void setCharacterMatcher(std::shared_ptr<const CharacterMatcher> matcher);  // Null clears name highlighting
+    void setStyleRules(std::shared_ptr<const StyleRuleSet> ruleSet);  // Null turns style linting off
+    void setEmbedded(bool embedded);  // No chrome or scroll bar; grows to fit the document
+    bool isEmbedded() const { return m_embedded; }
+    bool isLargeFileMode() const { return m_plainEditor != nullptr; }
+    void setBackgroundWorkPaused(bool paused);  // While not visible; catches up on resume
+    bool isBackgroundWorkPaused() const { return m_backgroundWorkPaused; }
+    
+    // Analyzer marks, kept per named layer so analyzers don't clobber each other
+    void setMarkedRanges(const QString& layer, const QList<QPair<int, int>>& ranges, const QTextCharFormat& format);
+    void setMarkLayer(const QString& layer, const QList<QTextEdit::ExtraSelection>& selections);
+    void clearMarkedRanges(const QString& layer);
+    void goToPosition(int position, int length = 0);
     
     // Rich text formatting
     void setBold(bool bold);
@@ -70,13 +100,21 @@ public:
     bool isUnderline() const;
     QColor textColor() const;
     Qt::Alignment alignment() const;
+    
+    // Constants
+    static const int LARGE_FILE_THRESHOLD = 2 * 1024 * 1024;   // Bytes; larger files open as plain text
+    static const int PIECE_TABLE_THRESHOLD = 10 * 1024 * 1024; // Bytes; larger files also save from a piece table
 
 signals:
     void contentChanged();
+    void modificationChanged(bool modified);  // Only fires on clean<->dirty transitions
     void wordCountChanged(int wordCount);
+    void statisticsChanged();
     void wordSelected(const QString& word);
     void hashtagClicked(const QString& hashtag);
     void formattingChanged();  // New signal for rich text formatting changes
+    void cursorRectChanged(const QRect& rect);  // Embedded mode only, in this widget's coordinates
+    void saveFinished(bool saved);  // Queued large-file writes only
 
 private slots:
     void onTextChanged();
@@ -86,6 +124,7 @@ private slots:
     void translateWord();
     void addHashtag();
     void onCursorPositionChanged();  // New slot for rich text formatting updates
+    void onContentsChange(int position, int charsRemoved, int charsAdded);
 
 private:
     void setupUI();
@@ -93,7 +132,18 @@ private:
     void setupStatusBar();
     void setupToolbar();  // New method for rich text toolbar
     void updateStatusBar();
+    void updateStatistics();
     void updateFormattingButtons();  // Update toolbar button states
+    void setModified(bool modified);
+    void applyMarkedRanges();
+    void fitToDocument();
+    void enterLargeFileMode();
+    bool startPieceTableSave(const QString& filePath);
+    bool onSaveFinished();
+    QTextDocument* activeDocument() const;
+    QAbstractScrollArea* activeEditor() const;
+    QTextCursor activeCursor() const;
+    void setActiveCursor(const QTextCursor& cursor);
     QString getSelectedWord() const;
     QStringList extractHashtags(const QString& text) const;
     
@@ -101,11 +151,19 @@ private:
     QVBoxLayout* m_mainLayout;
     QToolBar* m_toolbar;  // Rich text formatting toolbar
     QTextEdit* m_textEditor;
+    QPlainTextEdit* m_plainEditor;  // Replaces m_textEditor for large files; null otherwise
+    std::unique_ptr<PieceTable> m_pieceTable;  // Mirrors m_plainEditor for huge files; null otherwise
+    QFutureWatcher<bool>* m_saveWatcher;  // Non-null while a piece table snapshot is being written
     QHBoxLayout* m_statusLayout;
     QLabel* m_wordCountLabel;
     QLabel* m_characterCountLabel;
     QLabel* m_targetLabel;
+    QLabel* m_sentenceLabel;
+    QLabel* m_readabilityLabel;
     QLabel* m_filePathLabel;
+    HeadingNumberOverlay* m_headingOverlay;  // Created on first use
+    CharacterHighlighter* m_characterHighlighter;  // Created on first use
+    StyleLinter* m_styleLinter;  // Created on first use
     
     // Toolbar actions
     QAction* m_boldAction;
@@ -131,13 +189,20 @@ private:
     // State
     QString m_filePath;
     bool m_hasUnsavedChanges;
+    bool m_settingContent;  // Suppresses edit notifications while loading
+    bool m_embedded;
+    bool m_backgroundWorkPaused;
+    bool m_statisticsStale;  // Edits arrived while paused
+    QMetaObject::Connection m_fitConnection;  // Document size tracking while embedded
     int m_wordTarget;
-    QTimer* m_updateTimer;
+    CoalescedTimer* m_updateTimer;
+    QHash<QString, QList<QTextEdit::ExtraSelection>> m_markLayers;  // Layer name -> selections
     
     // Statistics
     int m_currentWordCount;
     int m_currentCharCount;
     int m_currentParagraphCount;
+    DocumentStatistics m_statistics;
 };
 
 #endif // EDITORWIDGET_H
\ No newline at end of file
@@ -0,0 +1,142 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "HeadingNumberOverlay.h"
+#include <QPainter>
+#include <QPaintEvent>
+#include <QScrollBar>
+#include <QTextBlock>
+#include <QTextDocument>
+#include <QAbstractTextDocumentLayout>
+
+HeadingNumberOverlay::HeadingNumberOverlay(QTextEdit* editor)
+    : QWidget(editor->viewport())
+    , m_editor(editor)
+    , m_chapterNumber(0)
+    , m_outlineDirty(true)
+{
+    // Purely visual: clicks and keys go straight to the editor
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setAttribute(Qt::WA_NoSystemBackground);
+    setFocusPolicy(Qt::NoFocus);
+    
+    resize(editor->viewport()->size());
+    editor->viewport()->installEventFilter(this);
+    
+    connect(editor->document(), &QTextDocument::contentsChanged, this, &HeadingNumberOverlay::onDocumentChanged);
+    connect(editor->verticalScrollBar(), &QScrollBar::valueChanged, this, qOverload<>(&QWidget::update));
+    connect(editor->horizontalScrollBar(), &QScrollBar::valueChanged, this, qOverload<>(&QWidget::update));
+    
+    hide();
+}
+
+HeadingNumberOverlay::~HeadingNumberOverlay() = default;
+
+void HeadingNumberOverlay::setChapterNumber(int chapterNumber)
+{
+    if (m_chapterNumber == chapterNumber) {
+        return;
+    }
+    
+    m_chapterNumber = chapterNumber;
+    setVisible(chapterNumber > 0);
+    update();
+}
+
+void HeadingNumberOverlay::paintEvent(QPaintEvent* event)
+{
+    Q_UNUSED(event)
+    
+    if (m_chapterNumber <= 0) {
+        return;
+    }
+    
+    if (m_outlineDirty) {
+        rebuildOutline();
+    }
+    
+    if (m_headings.isEmpty()) {
+        return;
+    }
+    
+    QTextDocument* document = m_editor->document();
+    QAbstractTextDocumentLayout* layout = document->documentLayout();
+    int xOffset = m_editor->horizontalScrollBar()->value();
+    int yOffset = m_editor->verticalScrollBar()->value();
+    int firstVisibleBlock = m_editor->cursorForPosition(QPoint(0, 0)).blockNumber();
+    
+    QPainter painter(this);
+    QFont labelFont = m_editor->font();
+    labelFont.setPointSizeF(labelFont.pointSizeF() * 0.85);
+    painter.setFont(labelFont);
+    painter.setPen(QColor(150, 150, 150));
+    
+    // Only headings inside the viewport are laid out and painted
+    for (const HeadingMark& heading : std::as_const(m_headings)) {
+        if (heading.blockNumber < firstVisibleBlock) {
+            continue;
+        }
+        
+        QTextBlock block = document->findBlockByNumber(heading.blockNumber);
+        if (!block.isValid()) {
+            break;
+        }
+        
+        QRectF blockRect = layout->blockBoundingRect(block).translated(-xOffset, -yOffset);
+        if (blockRect.top() > height()) {
+            break;
+        }
+        
+        QString label = (heading.subsectionNumber == 0)
+            ? QString("Chapter %1").arg(m_chapterNumber)
+            : QString("%1.%2").arg(m_chapterNumber).arg(heading.subsectionNumber);
+        
+        QRectF labelRect(0, blockRect.top(), width() - 8, painter.fontMetrics().height() + 4);
+        painter.drawText(labelRect, Qt::AlignRight | Qt::AlignVCenter, label);
+    }
+}
+
+bool HeadingNumberOverlay::eventFilter(QObject* watched, QEvent* event)
+{
+    if (watched == m_editor->viewport() && event->type() == QEvent::Resize) {
+        resize(m_editor->viewport()->size());
+    }
+    
+    return QWidget::eventFilter(watched, event);
+}
+
+void HeadingNumberOverlay::onDocumentChanged()
+{
+    // Rebuilt lazily on the next paint, so bursts of edits cost one scan
+    m_outlineDirty = true;
+    if (isVisible()) {
+        update();
+    }
+}
+
+void HeadingNumberOverlay::rebuildOutline()
+{
+    m_headings.clear();
+    
+    bool chapterHeadingFound = false;
+    int subsectionNumber = 0;
+    
+    for (QTextBlock block = m_editor->document()->begin(); block.isValid(); block = block.next()) {
+        const QString text = block.text();
+        if (!text.startsWith('#')) {
+            continue;
+        }
+        
+        if (text.startsWith("##") && text.size() > 2 && text.at(2).isSpace()) {
+            m_headings.append({block.blockNumber(), ++subsectionNumber});
+        } else if (!chapterHeadingFound && text.size() > 1 && text.at(1).isSpace()) {
+            m_headings.append({block.blockNumber(), 0});
+            chapterHeadingFound = true;
+        }
+    }
+    
+    m_outlineDirty = false;
+}
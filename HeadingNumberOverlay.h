@@ -0,0 +1,48 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef HEADINGNUMBEROVERLAY_H
+#define HEADINGNUMBEROVERLAY_H
+
+#include <QWidget>
+#include <QTextEdit>
+#include <QList>
+
+// Paints computed chapter/subsection numbers beside "#" and "##" headings
+// without changing the document, so stored headings can stay unnumbered.
+class HeadingNumberOverlay : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit HeadingNumberOverlay(QTextEdit* editor);
+    ~HeadingNumberOverlay();
+
+    void setChapterNumber(int chapterNumber);
+    int getChapterNumber() const { return m_chapterNumber; }
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private slots:
+    void onDocumentChanged();
+
+private:
+    void rebuildOutline();
+
+    struct HeadingMark {
+        int blockNumber;
+        int subsectionNumber;  // 0 for the chapter heading
+    };
+
+    QTextEdit* m_editor;
+    int m_chapterNumber;
+    QList<HeadingMark> m_headings;  // Cached outline of the open document
+    bool m_outlineDirty;
+};
+
+#endif // HEADINGNUMBEROVERLAY_H
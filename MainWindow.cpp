@@ -13,6 +13,28 @@
 #include "AutoSaveManager.h"
 #include "DraggableTabWidget.h"
 #include "UpdateManager.h"
+#include "DocumentRegistry.h"
+#include "DocumentStateService.h"
+#include "CharacterDatabase.h"
+#include "CharacterMentionIndex.h"
+#include "NameConsistencyChecker.h"
+#include "NameConsistencyPanel.h"
+#include "Corkboard.h"
+#include "CorkboardView.h"
+#include "WordFrequencyAnalyzer.h"
+#include "WordFrequencyPanel.h"
+#include "RepeatedPhraseDetector.h"
+#include "RepeatedPhrasePanel.h"
+#include "StatisticsPanel.h"
+#include "StyleRules.h"
+#include "SessionRecorder.h"
+#include "SessionDashboard.h"
+#include "ManuscriptPaginator.h"
+#include "ManuscriptExporter.h"
+#include "ScriveningView.h"
+#include "VisibilityTracker.h"
+#include "TickService.h"
+#include "Workspace.h"
 #include <QApplication>
 #include <QMessageBox>
 #include <QFileDialog>
@@ -22,6 +44,31 @@
 #include <QRegularExpression>
 #include <QDir>
 #include <QFile>
+#include <QTextCharFormat>
+#include <QColor>
+#include <QSettings>
+#include <QProgressDialog>
+
+namespace {
+
+// Analyzer results of a background project, handed back when it is active again
+class ParkedAnalysis : public ProjectCache
+{
+public:
+    CharacterMentionIndex::Results mentions;
+    NameConsistencyChecker::Results names;
+    WordFrequencyAnalyzer::Results frequency;
+    RepeatedPhraseDetector::Results phrases;
+    ManuscriptPaginator::Results pagination;
+    
+    qint64 estimateMemoryUsage() const override
+    {
+        return mentions.estimateMemoryUsage() + names.estimateMemoryUsage() + frequency.estimateMemoryUsage() +
+               phrases.estimateMemoryUsage() + pagination.estimateMemoryUsage();
+    }
+};
+
+}
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -30,11 +77,28 @@ MainWindow::MainWindow(QWidget *parent)
     , m_leftPane(nullptr)
     , m_centerPane(nullptr)
     , m_rightPane(nullptr)
-    , m_projectManager(std::make_unique<ProjectManager>(this))
+    , m_workspace(std::make_unique<Workspace>(this))
+    , m_projectManager(m_workspace->getActiveProject())
     , m_paneManager(std::make_unique<PaneManager>(this))
     , m_autoSaveManager(std::make_unique<AutoSaveManager>(this))
     , m_updateManager(std::make_unique<UpdateManager>(this))
+    , m_documentRegistry(std::make_unique<DocumentRegistry>(this))
+    , m_documentState(std::make_unique<DocumentStateService>(this))
+    , m_mentionIndex(std::make_unique<CharacterMentionIndex>(this))
+    , m_nameChecker(std::make_unique<NameConsistencyChecker>(this))
+    , m_wordFrequency(std::make_unique<WordFrequencyAnalyzer>(this))
+    , m_phraseDetector(std::make_unique<RepeatedPhraseDetector>(this))
+    , m_sessionRecorder(std::make_unique<SessionRecorder>(this))
+    , m_paginator(std::make_unique<ManuscriptPaginator>(this))
+    , m_exporter(std::make_unique<ManuscriptExporter>(this))
+    , m_visibilityTracker(std::make_unique<VisibilityTracker>(this))
     , m_projectTree(nullptr)
+    , m_namePanel(nullptr)
+    , m_wordFrequencyPanel(nullptr)
+    , m_phrasePanel(nullptr)
+    , m_statisticsPanel(nullptr)
+    , m_sessionDashboard(nullptr)
+    , m_scriveningView(nullptr)
     , m_currentProjectPath("")
     , m_projectModified(false)
     , m_currentEditor(nullptr)
@@ -100,11 +164,40 @@ void MainWindow::setupUI()
     connect(m_rightPane, &DraggableTabWidget::tabDetached, this, &MainWindow::onTabDetached);
     connect(m_rightPane, &DraggableTabWidget::tabAttachRequested, this, &MainWindow::onTabAttachRequested);
     
+    // Keep the document registry in sync with tab moves between containers
+    m_documentRegistry->watchTabWidget(m_leftPane);
+    m_documentRegistry->watchTabWidget(m_centerPane);
+    m_documentRegistry->watchTabWidget(m_rightPane);
+    m_documentRegistry->watchPaneManager(m_paneManager.get());
+    
+    // Editors nobody can see hold their timers and linting until shown again
+    connect(m_documentRegistry.get(), &DocumentRegistry::documentRegistered, this, [this](EditorWidget* editor) {
+        m_visibilityTracker->watchEditor(editor);
+    });
+    connect(m_documentRegistry.get(), &DocumentRegistry::documentUnregistered, this, [this](EditorWidget* editor) {
+        m_visibilityTracker->unwatchEditor(editor);
+        editor->setBackgroundWorkPaused(false);
+    });
+    connect(m_visibilityTracker.get(), &VisibilityTracker::visibilityChanged, this, [](EditorWidget* editor, bool visible) {
+        editor->setBackgroundWorkPaused(!visible);
+    });
+    
     // Create and add project tree
     m_projectTree = new ProjectTreeWidget(this);
     connect(m_projectTree, &ProjectTreeWidget::itemOpenRequested, this, &MainWindow::openChapterFile);
+    connect(m_projectTree, &ProjectTreeWidget::corkboardOpenRequested, this, &MainWindow::openCorkboard);
     connect(m_projectTree, &ProjectTreeWidget::chapterCreated, this, &MainWindow::onChapterCreatedFromTree);
-    connect(m_projectTree, &ProjectTreeWidget::itemMoved, this, &MainWindow::onTreeItemMoved);
+    connect(m_projectTree, &ProjectTreeWidget::itemMoved, this,
+            [this](const QString& fromPath, const QString& toPath, ProjectTreeWidget::ItemType type, const QString& projectPath) {
+                onTreeItemMoved(fromPath, toPath, static_cast<int>(type), projectPath);
+            });
+    connect(m_projectTree, &ProjectTreeWidget::characterCreated, this, &MainWindow::onCharacterCreatedFromTree);
+    connect(m_projectTree, &ProjectTreeWidget::characterAliasesEditRequested,
+            this, &MainWindow::onCharacterAliasesEditRequested);
+    connect(m_projectTree, &ProjectTreeWidget::itemDeleted, this,
+            [this](const QString& path, ProjectTreeWidget::ItemType type) {
+                onTreeItemDeleted(path, static_cast<int>(type));
+            });
     
     // Connect itemRenamed with lambda to handle the signature properly
     connect(m_projectTree, &ProjectTreeWidget::itemRenamed, this, 
@@ -116,7 +209,8 @@ void MainWindow::setupUI()
     
     // Setup UpdateManager dependencies
     m_updateManager->setProjectTree(m_projectTree);
-    m_updateManager->setProjectManager(m_projectManager.get());
+    m_updateManager->setWorkspace(m_workspace.get());
+    m_projectTree->setUpdateManager(m_updateManager.get());
     
     // Connect update manager signals
     connect(m_updateManager.get(), &UpdateManager::updateError, this, [this](const QString& error) {
@@ -127,6 +221,110 @@ void MainWindow::setupUI()
         m_projectTree->refreshProject(projectPath);
     });
     
+    // Each open project stays loaded; switching only rebinds the shared services below
+    connect(m_workspace.get(), &Workspace::activeProjectChanged, this, &MainWindow::onActiveProjectChanged);
+    
+    // Project metadata is written in the background; surface failures here
+    connect(m_workspace.get(), &Workspace::saveFailed, this, [this](const QString& filePath, const QString& error) {
+        statusBar()->showMessage(QString("Failed to save %1: %2").arg(QFileInfo(filePath).fileName(), error), 5000);
+    });
+    
+    // Character mentions are indexed in the background and shown in the tree
+    m_mentionIndex->setCharacterDatabase(m_projectManager->getCharacterDatabase());
+    m_projectTree->setMentionIndex(m_mentionIndex.get());
+    connect(m_mentionIndex.get(), &CharacterMentionIndex::indexUpdated,
+            m_projectTree, &ProjectTreeWidget::updateCharacterMentions);
+    connect(m_workspace.get(), &Workspace::chapterOrderChanged,
+            this, &MainWindow::rebuildMentionIndex);
+    connect(m_workspace.get(), &Workspace::charactersChanged, this, [this]() {
+        if (!m_currentProjectPath.isEmpty()) {
+            m_projectTree->refreshProject(m_currentProjectPath);
+        }
+    });
+    
+    // Manuscript page counts are estimated in the background and shown in the tree
+    m_projectTree->setPaginator(m_paginator.get());
+    connect(m_paginator.get(), &ManuscriptPaginator::pageCountsChanged,
+            m_projectTree, &ProjectTreeWidget::updatePageCounts);
+    connect(m_workspace.get(), &Workspace::chapterOrderChanged,
+            this, &MainWindow::paginateManuscript);
+    connect(m_workspace.get(), &Workspace::chapterOrderChanged, this, [this]() {
+        if (m_scriveningView) {
+            m_scriveningView->setChapters(chapterFilePaths());
+        }
+    });
+    
+    // Near-miss character names are checked in the background and listed in the right pane
+    m_namePanel = new NameConsistencyPanel();
+    m_nameChecker->setCharacterDatabase(m_projectManager->getCharacterDatabase());
+    connect(m_nameChecker.get(), &NameConsistencyChecker::dictionaryChanged,
+            this, &MainWindow::checkNameConsistency);
+    connect(m_workspace.get(), &Workspace::chapterOrderChanged,
+            this, &MainWindow::checkNameConsistency);
+    connect(m_nameChecker.get(), &NameConsistencyChecker::issuesUpdated, this, [this]() {
+        m_namePanel->setChecking(m_nameChecker->isChecking());
+        m_namePanel->setIssues(m_nameChecker->getIssues());
+        const QList<EditorWidget*> editors = m_documentRegistry->editors();
+        for (EditorWidget* editor : editors) {
+            applyNameIssues(editor);
+        }
+    });
+    connect(m_namePanel, &NameConsistencyPanel::recheckRequested, this, &MainWindow::checkNameConsistency);
+    connect(m_namePanel, &NameConsistencyPanel::issueActivated, this, &MainWindow::showChapterPosition);
+    
+    // Word frequencies are counted in parallel on demand and on project load
+    m_wordFrequencyPanel = new WordFrequencyPanel();
+    m_wordFrequencyPanel->setAnalyzer(m_wordFrequency.get());
+    connect(m_wordFrequencyPanel, &WordFrequencyPanel::analyzeRequested, this, &MainWindow::analyzeWordFrequency);
+    
+    // Repeated phrases are found across chapters; results jump like tree items do
+    m_phrasePanel = new RepeatedPhrasePanel();
+    connect(m_phrasePanel, &RepeatedPhrasePanel::detectRequested, this, &MainWindow::detectRepeatedPhrases);
+    connect(m_phrasePanel, &RepeatedPhrasePanel::occurrenceActivated, this, &MainWindow::showChapterPosition);
+    connect(m_phraseDetector.get(), &RepeatedPhraseDetector::detectionFinished, this, [this]() {
+        m_phrasePanel->setDetecting(m_phraseDetector->isDetecting());
+        m_phrasePanel->setPhrases(m_phraseDetector->getPhrases());
+    });
+    
+    // Writing history is appended by the recorder and read back on demand
+    m_sessionDashboard = new SessionDashboard();
+    connect(m_sessionDashboard, &SessionDashboard::refreshRequested, this, &MainWindow::refreshSessionDashboard);
+    connect(m_sessionRecorder.get(), &SessionRecorder::historyChanged, this, &MainWindow::refreshSessionDashboard);
+    
+    // Open editors pick up each rebuilt name matcher of their own project as soon as it is swapped in
+    connect(m_workspace.get(), &Workspace::matcherChanged, this, [this](ProjectManager* project) {
+        std::shared_ptr<const CharacterMatcher> matcher = project->getCharacterDatabase()->getMatcher();
+        const QList<EditorWidget*> editors = m_documentRegistry->editors();
+        for (EditorWidget* editor : editors) {
+            if (projectForFile(m_documentRegistry->pathForEditor(editor)) == project) {
+                editor->setCharacterMatcher(matcher);
+            }
+        }
+    });
+    
+    // Computed heading numbers follow the chapter order without touching files
+    connect(m_workspace.get(), &Workspace::chapterOrderChanged,
+            this, &MainWindow::applyHeadingNumberingToAll);
+    connect(m_workspace.get(), &Workspace::headingNumberingChanged, this, [this](bool computed) {
+        m_computedNumberingAction->setChecked(computed);
+        applyHeadingNumberingToAll();
+        if (!m_currentProjectPath.isEmpty()) {
+            m_projectTree->refreshProject(m_currentProjectPath);
+        }
+    });
+    
+    // Tab indicators only need refreshing when an editor flips between clean and dirty
+    m_autoSaveManager->setDocumentStateService(m_documentState.get());
+    connect(m_documentState.get(), &DocumentStateService::dirtyStateChanged,
+            this, [this](EditorWidget* editor, bool dirty) {
+                updateTabIndicator(editor);
+                // A save is the point where on-disk mentions change; the shared index holds the active project only
+                QString filePath = m_documentRegistry->pathForEditor(editor);
+                if (!dirty && projectForFile(filePath) == m_projectManager) {
+                    m_mentionIndex->updateChapter(filePath, editor->getContent());
+                }
+            });
+    
     // Connect auto-save manager signals for change indicators
     connect(m_autoSaveManager.get(), &AutoSaveManager::autoSaveCompleted, 
             this, [this](int filesSaved) {
@@ -145,8 +343,13 @@ void MainWindow::setupUI()
     m_centerPane->addTab(welcomeWidget, "Welcome");
     
     m_rightPane->addTab(new QWidget(), "References");
-    m_rightPane->addTab(new QWidget(), "Statistics");
+    m_statisticsPanel = new StatisticsPanel();
+    m_rightPane->addTab(m_statisticsPanel, "Statistics");
     m_rightPane->addTab(new QWidget(), "Corkboard");
+    m_rightPane->addTab(m_namePanel, "Names");
+    m_rightPane->addTab(m_wordFrequencyPanel, "Frequency");
+    m_rightPane->addTab(m_phrasePanel, "Repeats");
+    m_rightPane->addTab(m_sessionDashboard, "Sessions");
     
     // Add panes to splitter
     m_mainSplitter->addWidget(m_leftPane);
@@ -244,6 +447,11 @@ void MainWindow::setupMenus()
     m_splitVerticalAction = new QAction("Split &Vertical", this);
     connect(m_splitVerticalAction, &QAction::triggered, this, &MainWindow::splitVertical);
     viewMenu->addAction(m_splitVerticalAction);
+    viewMenu->addSeparator();
+    
+    QAction* scriveningsAction = viewMenu->addAction("&Scrivenings");
+    scriveningsAction->setShortcut(QKeySequence("Ctrl+Shift+M"));
+    connect(scriveningsAction, &QAction::triggered, this, &MainWindow::openScrivenings);
     
     // Format Menu
     QMenu* formatMenu = menuBar()->addMenu("&Format");
@@ -256,7 +464,29 @@ void MainWindow::setupMenus()
     QMenu* toolsMenu = menuBar()->addMenu("&Tools");
     toolsMenu->addAction("Word Count &Targets...");
     toolsMenu->addAction("&Statistics...");
-    toolsMenu->addAction("&Export...");
+    QAction* exportAction = toolsMenu->addAction("&Export Manuscript PDF...");
+    connect(exportAction, &QAction::triggered, this, &MainWindow::exportManuscript);
+    toolsMenu->addSeparator();
+    
+    m_computedNumberingAction = new QAction("&Computed Heading Numbers", this);
+    m_computedNumberingAction->setCheckable(true);
+    m_computedNumberingAction->setToolTip("Number chapters and subsections on display instead of storing numbers in files");
+    connect(m_computedNumberingAction, &QAction::toggled, this, [this](bool checked) {
+        if (m_projectManager->isComputedHeadingNumbering() != checked) {
+            m_projectManager->setComputedHeadingNumbering(checked);
+        }
+    });
+    toolsMenu->addAction(m_computedNumberingAction);
+    
+    m_styleLintingAction = new QAction("Style &Linting", this);
+    m_styleLintingAction->setCheckable(true);
+    m_styleLintingAction->setToolTip("Mark adverb-heavy paragraphs, passive voice, filter words and long sentences");
+    m_styleLintingAction->setChecked(QSettings().value("Editor/styleLinting", true).toBool());
+    connect(m_styleLintingAction, &QAction::toggled, this, [this](bool checked) {
+        QSettings().setValue("Editor/styleLinting", checked);
+        loadStyleRules();
+    });
+    toolsMenu->addAction(m_styleLintingAction);
     
     // Help Menu
     QMenu* helpMenu = menuBar()->addMenu("&Help");
@@ -274,6 +504,16 @@ void MainWindow::setupStatusBar()
     m_projectStatusLabel->setStyleSheet("color: #666; font-style: italic;");
     statusBar()->addPermanentWidget(m_projectStatusLabel);
     
+    // Timer wakeups per minute; refreshed on the shared tick so the counter
+    // never adds a wakeup of its own
+    m_wakeupLabel = new QLabel("Wakeups: 0/min");
+    m_wakeupLabel->setStyleSheet("color: #666;");
+    m_wakeupLabel->setToolTip("Timer wakeups in the last minute");
+    statusBar()->addPermanentWidget(m_wakeupLabel);
+    connect(TickService::instance(), &TickService::ticked, this, [this]() {
+        m_wakeupLabel->setText(QString("Wakeups: %1/min").arg(TickService::instance()->getWakeupsPerMinute()));
+    });
+    
     // Ensure status bar is always visible with minimum height
     statusBar()->setMinimumHeight(20);
     statusBar()->setSizeGripEnabled(true);
@@ -296,9 +536,9 @@ void MainWindow::updateWindowTitle(const QString& projectName)
     setWindowTitle(title);
 }
 
-void MainWindow::updateTabIndicator(EditorWidget* editor, int tabIndex)
+void MainWindow::updateTabIndicator(EditorWidget* editor)
 {
-    if (!editor || tabIndex < 0 || tabIndex >= m_centerPane->count()) {
+    if (!editor) {
         return;
     }
     
@@ -314,20 +554,124 @@ void MainWindow::updateTabIndicator(EditorWidget* editor, int tabIndex)
         tabText = baseText;
     }
     
-    // Only update if the text actually changed to avoid unnecessary updates
-    if (m_centerPane->tabText(tabIndex) != tabText) {
-        m_centerPane->setTabText(tabIndex, tabText);
+    // The editor may live in any tab widget or in a detached window
+    QWidget* container = m_documentRegistry->containerForEditor(editor);
+    if (QTabWidget* tabWidget = qobject_cast<QTabWidget*>(container)) {
+        int tabIndex = m_documentRegistry->tabIndexForEditor(editor);
+        // Only update if the text actually changed to avoid unnecessary updates
+        if (tabIndex >= 0 && tabWidget->tabText(tabIndex) != tabText) {
+            tabWidget->setTabText(tabIndex, tabText);
+        }
+    } else if (ScriveningView* view = qobject_cast<ScriveningView*>(container)) {
+        view->setChapterModified(m_documentRegistry->pathForEditor(editor), editor->hasUnsavedChanges());
+    } else if (container && container->windowTitle() != tabText) {
+        container->setWindowTitle(tabText);
     }
 }
 
 void MainWindow::updateAllTabIndicators()
 {
-    for (int i = 0; i < m_centerPane->count(); ++i) {
-        QWidget* widget = m_centerPane->widget(i);
-        EditorWidget* editor = qobject_cast<EditorWidget*>(widget);
-        if (editor) {
-            updateTabIndicator(editor, i);
+    const QList<EditorWidget*> editors = m_documentRegistry->editors();
+    for (EditorWidget* editor : editors) {
+        updateTabIndicator(editor);
+    }
+}
+
+void MainWindow::trackEditor(EditorWidget* editor, const QString& filePath, QWidget* container)
+{
+    // Track the editor with the registry, state service and auto-save
+    m_documentRegistry->registerDocument(editor, filePath, container);
+    m_documentState->watchEditor(editor);
+    m_currentEditor = editor;
+    m_autoSaveManager->registerEditor(editor, filePath);
+    applyHeadingNumbering(editor);
+    ProjectManager* project = projectForFile(filePath);
+    editor->setCharacterMatcher(project->getCharacterDatabase()->getMatcher());
+    editor->setStyleRules(m_styleRules);
+    applyNameIssues(editor);
+    
+    // Sessions are logged by stable chapter ID so renamed chapters keep their history
+    QString chapterId = project->getChapterId(QFileInfo(filePath).fileName());
+    m_sessionRecorder->trackEditor(editor, chapterId.isEmpty() ? QFileInfo(filePath).fileName() : chapterId);
+    
+    // Recheck names once typing pauses; unchanged paragraphs come from the cache
+    connect(editor, &EditorWidget::wordCountChanged, this, [this, editor]() {
+        // Large files are research dumps, not manuscript, and too big to copy out per pause
+        if (editor->isLargeFileMode()) {
+            return;
+        }
+        QString chapterPath = m_documentRegistry->pathForEditor(editor);
+        QString content = editor->getContent();
+        m_nameChecker->checkText(chapterPath, content);
+        m_paginator->paginateText(chapterPath, content);
+    });
+    connect(editor, &EditorWidget::saveFinished, this, [this](bool saved) {
+        if (saved) {
+            statusBar()->showMessage("Chapter saved", 2000);
+        }
+    });
+    connect(editor, &EditorWidget::contentChanged, this, [this, editor]() {
+        // Results parked with a background project no longer match its text
+        ProjectManager* owner = projectForFile(m_documentRegistry->pathForEditor(editor));
+        if (owner != m_projectManager) {
+            owner->takeParkedCache();
+        }
+    });
+    connect(editor, &EditorWidget::statisticsChanged, this, [this, editor]() {
+        if (editor == m_currentEditor) {
+            updateStatisticsPanel();
         }
+    });
+    updateStatisticsPanel();
+}
+
+void MainWindow::updateStatisticsPanel()
+{
+    if (!m_currentEditor) {
+        m_statisticsPanel->clear();
+        return;
+    }
+    
+    QString title = QFileInfo(m_documentRegistry->pathForEditor(m_currentEditor)).baseName();
+    m_statisticsPanel->setStatistics(title, m_currentEditor->getStatistics());
+}
+
+void MainWindow::applyNameIssues(EditorWidget* editor)
+{
+    QList<QPair<int, int>> ranges;
+    const QList<NameIssue> issues = m_nameChecker->getIssues(m_documentRegistry->pathForEditor(editor));
+    for (const NameIssue& issue : issues) {
+        ranges.append({issue.position, issue.length});
+    }
+    
+    QTextCharFormat format;
+    format.setUnderlineStyle(QTextCharFormat::WaveUnderline);
+    format.setUnderlineColor(QColor(220, 120, 0));
+    editor->setMarkedRanges("names", ranges, format);
+}
+
+void MainWindow::applyHeadingNumbering(EditorWidget* editor)
+{
+    if (!editor) {
+        return;
+    }
+    
+    int chapterNumber = 0;
+    QFileInfo fileInfo(m_documentRegistry->pathForEditor(editor));
+    ProjectManager* project = projectForFile(fileInfo.filePath());
+    if (project->isComputedHeadingNumbering() &&
+        fileInfo.absolutePath() == project->getCurrentProjectPath() + "/chapters") {
+        chapterNumber = project->getChapterNumber(fileInfo.fileName());
+    }
+    
+    editor->setHeadingNumbering(chapterNumber);
+}
+
+void MainWindow::applyHeadingNumberingToAll()
+{
+    const QList<EditorWidget*> editors = m_documentRegistry->editors();
+    for (EditorWidget* editor : editors) {
+        applyHeadingNumbering(editor);
     }
 }
 
@@ -377,28 +721,16 @@ bool MainWindow::renameProjectFile(const QString& oldPath, const QString& newPat
 void MainWindow::updateOpenEditorPath(const QString& oldPath, const QString& newPath)
 {
     // Update the editor's file path if it's currently open
-    if (m_openEditors.contains(oldPath)) {
-        EditorWidget* editor = m_openEditors[oldPath];
-        
-        // Remove from old path mapping
-        m_openEditors.remove(oldPath);
-        
+    if (EditorWidget* editor = m_documentRegistry->editorForPath(oldPath)) {
         // Update editor's internal file path
         editor->setFilePath(newPath);
         
-        // Update auto-save manager
+        // Update auto-save manager and path mapping
         m_autoSaveManager->updateFilePath(editor, newPath);
-        
-        // Add to new path mapping
-        m_openEditors[newPath] = editor;
+        m_documentRegistry->updateFilePath(editor, newPath);
         
         // Update tab indicator
-        for (int i = 0; i < m_centerPane->count(); ++i) {
-            if (m_centerPane->widget(i) == editor) {
-                updateTabIndicator(editor, i);
-                break;
-            }
-        }
+        updateTabIndicator(editor);
         
         qDebug() << "Updated open editor path:" << oldPath << "→" << newPath;
     }
@@ -412,19 +744,14 @@ void MainWindow::newProject()
         QString projectPath = dialog.getProjectPath();
         QString projectName = dialog.getProjectName();
         
-        if (m_projectManager->createProject(projectPath, projectName)) {
-            m_currentProjectPath = projectPath;
-            updateWindowTitle(projectName);
-            m_projectStatusLabel->setText(QString("Project: %1").arg(projectName));
-            statusBar()->showMessage("Project created successfully", 2000);
-            
-            // Connect project manager signals
-            connect(m_projectManager.get(), &ProjectManager::projectOpened, 
-                    this, &MainWindow::onProjectOpened);
-            
+        if (ProjectManager* project = m_workspace->createProject(projectPath, projectName)) {
             // Add to project tree
+            m_projectTree->setProjectManager(projectPath, project);
             m_projectTree->addProject(projectPath, projectName);
             
+            m_workspace->setActiveProject(projectPath);
+            statusBar()->showMessage("Project created successfully", 2000);
+            
             // Load existing chapters if any
             loadProjectChapters();
         } else {
@@ -442,19 +769,24 @@ void MainWindow::openProject()
         "NeuroDraft Projects (*.json)"
     );
     
-    if (!projectFile.isEmpty() && m_projectManager->openProject(projectFile)) {
-        m_currentProjectPath = QFileInfo(projectFile).absolutePath();
-        QString projectName = QFileInfo(m_currentProjectPath).baseName();
-        updateWindowTitle(projectName);
-        m_projectStatusLabel->setText(QString("Project: %1").arg(projectName));
-        statusBar()->showMessage("Project opened successfully", 2000);
-        
-        // Connect project manager signals
-        connect(m_projectManager.get(), &ProjectManager::projectOpened, 
-                this, &MainWindow::onProjectOpened);
-        
+    if (projectFile.isEmpty()) {
+        return;
+    }
+    
+    // Opening a project that is already open just switches to it
+    QString projectPath = QFileInfo(projectFile).absolutePath();
+    if (m_workspace->getProject(projectPath)) {
+        m_workspace->setActiveProject(projectPath);
+        return;
+    }
+    
+    if (ProjectManager* project = m_workspace->openProject(projectFile)) {
         // Add to project tree
-        m_projectTree->addProject(m_currentProjectPath, projectName);
+        m_projectTree->setProjectManager(projectPath, project);
+        m_projectTree->addProject(projectPath, QFileInfo(projectPath).baseName());
+        
+        m_workspace->setActiveProject(projectPath);
+        statusBar()->showMessage("Project opened successfully", 2000);
         
         // Load project chapters
         loadProjectChapters();
@@ -489,10 +821,28 @@ void MainWindow::closeProject()
         }
     }
     
-    m_currentProjectPath.clear();
+    // The manuscript view belongs to the project being closed
+    if (m_scriveningView) {
+        m_scriveningView->unloadAll();
+        m_centerPane->removeTab(m_centerPane->indexOf(m_scriveningView));
+        m_scriveningView->deleteLater();
+        m_scriveningView = nullptr;
+    }
+    
+    // Corkboards write through the closing project's file writer
+    QString projectPath = m_currentProjectPath;
+    for (int i = m_centerPane->count() - 1; i >= 0; --i) {
+        CorkboardView* view = qobject_cast<CorkboardView*>(m_centerPane->widget(i));
+        if (view && m_workspace->projectForFile(view->getFilePath()) == m_projectManager) {
+            m_centerPane->removeTab(i);
+            view->deleteLater();
+        }
+    }
+    
+    // The most recently used remaining project (if any) becomes active
+    m_projectTree->removeProject(projectPath);
+    m_workspace->closeProject(projectPath);
     m_projectModified = false;
-    updateWindowTitle();
-    m_projectStatusLabel->setText("No project loaded");
     statusBar()->showMessage("Project closed", 2000);
 }
 
@@ -554,31 +904,17 @@ void MainWindow::newChapter()
         // Add initial content
         editor->setContent("# " + chapterName + "\n\nBegin writing here...\n");
         
-        // Connect content change signal for tab indicators
-        connect(editor, &EditorWidget::contentChanged, this, [this, editor]() {
-            // Find the tab index for this editor
-            for (int i = 0; i < m_centerPane->count(); ++i) {
-                if (m_centerPane->widget(i) == editor) {
-                    updateTabIndicator(editor, i);
-                    break;
-                }
-            }
-        });
-        
-        // Add to center pane
+        // Add to center pane and track the editor
+        trackEditor(editor, chapterPath, m_centerPane);
         int tabIndex = m_centerPane->addTab(editor, chapterName);
         m_centerPane->setCurrentIndex(tabIndex);
         
-        // Track the editor with auto-save
-        m_openEditors[chapterPath] = editor;
-        m_currentEditor = editor;
-        m_autoSaveManager->registerEditor(editor, chapterPath);
-        
-        // Save immediately
+        // Save immediately and append it to the chapter order
         editor->saveToFile(chapterPath);
+        m_projectManager->addChapterToOrder(chapterPath);
         
         // Update tab indicator after save
-        updateTabIndicator(editor, tabIndex);
+        updateTabIndicator(editor);
         
         // Refresh the project tree to show the new chapter
         m_projectTree->refreshProject(m_currentProjectPath);
@@ -611,13 +947,9 @@ void MainWindow::saveCurrentChapter()
     if (m_currentEditor) {
         if (m_currentEditor->saveToFile(m_currentEditor->getFilePath())) {
             // Update tab indicator after save
-            for (int i = 0; i < m_centerPane->count(); ++i) {
-                if (m_centerPane->widget(i) == m_currentEditor) {
-                    updateTabIndicator(m_currentEditor, i);
-                    break;
-                }
-            }
-            statusBar()->showMessage("Chapter saved", 2000);
+            updateTabIndicator(m_currentEditor);
+            // Large files confirm from saveFinished once the write has landed
+            statusBar()->showMessage(m_currentEditor->isSaving() ? "Saving chapter..." : "Chapter saved", 2000);
         } else {
             QMessageBox::warning(this, "Error", "Failed to save chapter.");
         }
@@ -642,7 +974,8 @@ void MainWindow::selectFont()
         }
         
         // Apply to all open editors
-        for (auto* editor : m_openEditors) {
+        const QList<EditorWidget*> editors = m_documentRegistry->editors();
+        for (auto* editor : editors) {
             editor->setFont(font);
         }
         
@@ -650,11 +983,79 @@ void MainWindow::selectFont()
     }
 }
 
-void MainWindow::onProjectOpened(const QString& projectName)
+void MainWindow::onActiveProjectChanged(const QString& projectPath)
 {
+    // Nothing is reloaded from disk; the shared index and dictionary follow the active project
+    parkAnalysis(m_projectManager);
+    m_projectManager = m_workspace->getActiveProject();
+    m_currentProjectPath = projectPath;
+    m_mentionIndex->setCharacterDatabase(m_projectManager->getCharacterDatabase());
+    m_nameChecker->setCharacterDatabase(m_projectManager->getCharacterDatabase());
+    m_computedNumberingAction->setChecked(m_projectManager->isComputedHeadingNumbering());
+    m_projectTree->setActiveProject(projectPath);
+    
+    // Rules and the session log are per project, so set them up before any editor is tracked
+    loadStyleRules();
+    if (projectPath.isEmpty()) {
+        m_sessionRecorder->setLogPath(QString());
+        updateWindowTitle();
+        m_projectStatusLabel->setText("No project loaded");
+        return;
+    }
+    m_sessionRecorder->setLogPath(QDir(projectPath).filePath("sessions.ndts"));
+    
+    QString projectName = QFileInfo(projectPath).baseName();
     updateWindowTitle(projectName);
     m_projectStatusLabel->setText(QString("Project: %1").arg(projectName));
-    loadProjectChapters();
+    
+    if (m_scriveningView) {
+        m_scriveningView->setChapters(chapterFilePaths());
+    }
+    
+    // Parked results are current until the project changes; otherwise any
+    // scan still running for the previous project is superseded by key
+    if (!restoreAnalysis(m_projectManager)) {
+        rebuildMentionIndex();
+        checkNameConsistency();
+        analyzeWordFrequency();
+        detectRepeatedPhrases();
+        paginateManuscript();
+    }
+}
+
+void MainWindow::parkAnalysis(ProjectManager* project)
+{
+    // Half-finished results would pass for current ones on the way back
+    if (project->getCurrentProjectPath().isEmpty() ||
+        m_mentionIndex->isIndexing() || m_nameChecker->isChecking() || m_wordFrequency->isAnalyzing() ||
+        m_phraseDetector->isDetecting() || m_paginator->isPaginating()) {
+        return;
+    }
+    
+    auto analysis = std::make_unique<ParkedAnalysis>();
+    analysis->mentions = m_mentionIndex->takeResults();
+    analysis->names = m_nameChecker->takeResults();
+    analysis->frequency = m_wordFrequency->takeResults();
+    analysis->phrases = m_phraseDetector->takeResults();
+    analysis->pagination = m_paginator->takeResults();
+    project->parkCache(std::move(analysis));
+}
+
+bool MainWindow::restoreAnalysis(ProjectManager* project)
+{
+    std::unique_ptr<ProjectCache> cache = project->takeParkedCache();
+    if (!cache) {
+        return false;
+    }
+    
+    // Only this window parks caches with a project
+    auto* analysis = static_cast<ParkedAnalysis*>(cache.get());
+    m_mentionIndex->restoreResults(std::move(analysis->mentions));
+    m_nameChecker->restoreResults(std::move(analysis->names));
+    m_wordFrequency->restoreResults(std::move(analysis->frequency));
+    m_phraseDetector->restoreResults(std::move(analysis->phrases));
+    m_paginator->restoreResults(std::move(analysis->pagination));
+    return true;
 }
 
 void MainWindow::onChapterTabChanged(int index)
@@ -662,6 +1063,15 @@ void MainWindow::onChapterTabChanged(int index)
     if (index >= 0 && index < m_centerPane->count()) {
         QWidget* widget = m_centerPane->widget(index);
         m_currentEditor = qobject_cast<EditorWidget*>(widget);
+        updateStatisticsPanel();
+        
+        // Turning to another project's chapter makes that project active
+        if (m_currentEditor) {
+            ProjectManager* project = m_workspace->projectForFile(m_currentEditor->getFilePath());
+            if (project && project != m_projectManager) {
+                m_workspace->setActiveProject(project->getCurrentProjectPath());
+            }
+        }
         
         if (m_currentEditor) {
             QString tabText = m_centerPane->tabText(index);
@@ -685,22 +1095,38 @@ void MainWindow::onChapterTabCloseRequested(int index)
                 QMessageBox::Save | QMessageBox::Discard | QMessageBox::Cancel);
             
             if (ret == QMessageBox::Save) {
-                editor->saveToFile(editor->getFilePath());
+                if (!editor->saveToFile(editor->getFilePath())) {
+                    return;
+                }
             } else if (ret == QMessageBox::Cancel) {
                 return;
             }
         }
         
+        // A large file may still be writing; keep the tab (and its edits) if that fails
+        if (editor && !editor->waitForSave()) {
+            return;
+        }
+        
         // Remove from tracking
         if (editor) {
-            m_openEditors.remove(editor->getFilePath());
+            m_documentRegistry->unregisterDocument(editor);
             if (m_currentEditor == editor) {
                 m_currentEditor = nullptr;
             }
         }
         
-        // Remove tab
+        // Scrivenings save and release their chapter editors first
+        if (widget == m_scriveningView) {
+            m_scriveningView->unloadAll();
+            m_scriveningView = nullptr;
+        }
+        
+        // Remove tab; corkboards and scrivenings are not tracked anywhere else
         m_centerPane->removeTab(index);
+        if (qobject_cast<CorkboardView*>(widget) || qobject_cast<ScriveningView*>(widget)) {
+            widget->deleteLater();
+        }
         
         // Update current editor
         if (m_centerPane->count() > 0) {
@@ -709,6 +1135,85 @@ void MainWindow::onChapterTabCloseRequested(int index)
     }
 }
 
+void MainWindow::openCorkboard(const QString& boardPath)
+{
+    // Switch to the board if it is already open
+    for (int i = 0; i < m_centerPane->count(); ++i) {
+        CorkboardView* view = qobject_cast<CorkboardView*>(m_centerPane->widget(i));
+        if (view && view->getFilePath() == boardPath) {
+            m_centerPane->setCurrentIndex(i);
+            return;
+        }
+    }
+    
+    Corkboard* board = new Corkboard(projectForFile(boardPath)->getFileWriter());
+    if (!board->load(boardPath)) {
+        delete board;
+        QMessageBox::warning(this, "Error", "Cannot open corkboard: " + boardPath);
+        return;
+    }
+    
+    CorkboardView* view = new CorkboardView(board);
+    int tabIndex = m_centerPane->addTab(view, board->getName());
+    m_centerPane->setCurrentIndex(tabIndex);
+    statusBar()->showMessage(QString("Opened corkboard with %1 card(s)").arg(board->count()), 2000);
+}
+
+void MainWindow::openScrivenings()
+{
+    if (m_currentProjectPath.isEmpty()) {
+        statusBar()->showMessage("Open a project to view its scrivenings", 2000);
+        return;
+    }
+    if (m_scriveningView) {
+        m_centerPane->setCurrentWidget(m_scriveningView);
+        return;
+    }
+    
+    m_scriveningView = new ScriveningView(m_documentRegistry.get(), m_paginator.get());
+    ScriveningView* view = m_scriveningView;
+    
+    // Chapter editors are tracked like tabs so edits save to their own files
+    connect(view, &ScriveningView::editorLoaded, this, [this, view](EditorWidget* editor, const QString& chapterPath) {
+        // Loading while scrolling must not steal the current editor
+        EditorWidget* currentEditor = m_currentEditor;
+        trackEditor(editor, chapterPath, view);
+        m_currentEditor = currentEditor;
+        updateStatisticsPanel();
+        connect(editor, &EditorWidget::cursorRectChanged, this, [this, editor]() {
+            if (m_currentEditor != editor) {
+                m_currentEditor = editor;
+                updateStatisticsPanel();
+            }
+        });
+    });
+    connect(view, &ScriveningView::editorAdoptionRequested, this, [this, view](EditorWidget* editor) {
+        // Chapters open in a tab move into the view; detached windows keep theirs
+        QTabWidget* tabWidget = qobject_cast<QTabWidget*>(m_documentRegistry->containerForEditor(editor));
+        int tabIndex = m_documentRegistry->tabIndexForEditor(editor);
+        if (tabWidget && tabIndex >= 0) {
+            tabWidget->removeTab(tabIndex);
+            m_documentRegistry->updateContainer(editor, view);
+        }
+    });
+    connect(view, &ScriveningView::editorUnloading, this, [this](EditorWidget* editor) {
+        if (editor->hasUnsavedChanges()) {
+            m_autoSaveManager->saveEditor(editor);
+        }
+        editor->waitForSave();
+        m_autoSaveManager->unregisterEditor(editor);
+        m_documentRegistry->unregisterDocument(editor);
+        if (m_currentEditor == editor) {
+            m_currentEditor = nullptr;
+            updateStatisticsPanel();
+        }
+    });
+    
+    int tabIndex = m_centerPane->addTab(view, "Manuscript");
+    m_centerPane->setCurrentIndex(tabIndex);
+    view->setChapters(chapterFilePaths());
+}
+
 void MainWindow::loadProjectChapters()
 {
     if (m_currentProjectPath.isEmpty()) {
@@ -726,31 +1231,215 @@ void MainWindow::loadProjectChapters()
     // Refresh the project tree first
     m_projectTree->refreshProject(m_currentProjectPath);
     
-    // Load existing chapters
-    QStringList chapters = m_projectManager->getChapterList();
+    // Load existing chapters in manifest order
+    QStringList chapters = m_projectManager->getChapterFiles();
     QString chaptersPath = QDir(m_currentProjectPath).filePath("chapters");
     
     for (const QString& chapter : chapters) {
-        QString chapterPath = QDir(chaptersPath).filePath(chapter + ".md");
+        QString chapterPath = QDir(chaptersPath).filePath(chapter);
         if (QFile::exists(chapterPath)) {
             openChapterFile(chapterPath);
         }
     }
     
+    // Analyses were started on activation and already see the files just opened
     statusBar()->showMessage(QString("Loaded %1 chapters").arg(chapters.size()), 2000);
 }
 
+void MainWindow::loadStyleRules()
+{
+    // Compiled once here and shared by every editor's linter
+    m_styleRules.reset();
+    if (m_styleLintingAction->isChecked() && !m_currentProjectPath.isEmpty()) {
+        QString rulesPath = QDir(m_currentProjectPath).filePath("style_rules.json");
+        m_styleRules = StyleRuleSet::compile(StyleRuleSet::loadRules(rulesPath));
+    }
+    
+    const QList<EditorWidget*> editors = m_documentRegistry->editors();
+    for (EditorWidget* editor : editors) {
+        editor->setStyleRules(m_styleRules);
+    }
+}
+
+void MainWindow::refreshSessionDashboard()
+{
+    QDate today = QDate::currentDate();
+    m_sessionDashboard->setHistory(m_sessionRecorder->getDailyTotals(
+        today.addDays(1 - SessionDashboard::HISTORY_DAYS), today));
+}
+
+void MainWindow::rebuildMentionIndex()
+{
+    if (m_projectManager->getCurrentProjectPath().isEmpty()) {
+        m_mentionIndex->clear();
+        return;
+    }
+    
+    m_mentionIndex->rebuild(chapterFilePaths());
+}
+
+void MainWindow::checkNameConsistency()
+{
+    if (m_projectManager->getCurrentProjectPath().isEmpty()) {
+        m_nameChecker->clear();
+        return;
+    }
+    
+    m_namePanel->setChecking(true);
+    m_nameChecker->checkChapters(chapterFilePaths(), openEditorTexts());
+}
+
+void MainWindow::analyzeWordFrequency()
+{
+    if (m_projectManager->getCurrentProjectPath().isEmpty()) {
+        m_wordFrequency->clear();
+        return;
+    }
+    
+    m_wordFrequency->analyze(chapterFilePaths(), openEditorTexts());
+    m_wordFrequencyPanel->refresh();
+}
+
+void MainWindow::detectRepeatedPhrases()
+{
+    if (m_projectManager->getCurrentProjectPath().isEmpty()) {
+        m_phraseDetector->clear();
+        return;
+    }
+    
+    m_phrasePanel->setDetecting(true);
+    m_phraseDetector->detect(chapterFilePaths(), openEditorTexts());
+}
+
+void MainWindow::paginateManuscript()
+{
+    if (m_projectManager->getCurrentProjectPath().isEmpty()) {
+        m_paginator->clear();
+        return;
+    }
+    
+    // Unchanged chapters only re-place their cached block heights
+    m_paginator->paginate(chapterFilePaths(), openEditorTexts());
+}
+
+void MainWindow::exportManuscript()
+{
+    if (m_projectManager->getCurrentProjectPath().isEmpty()) {
+        QMessageBox::information(this, "Export Manuscript", "Open a project to export its manuscript.");
+        return;
+    }
+    if (m_exporter->isExporting()) {
+        statusBar()->showMessage("An export is already running", 2000);
+        return;
+    }
+    
+    // One snapshot for the whole export, so chapters, title and author agree
+    std::shared_ptr<const ProjectSnapshot> snapshot = m_projectManager->getSnapshot();
+    QString title = snapshot->getTitle();
+    QString outputPath = QFileDialog::getSaveFileName(
+        this,
+        "Export Manuscript",
+        QDir(m_currentProjectPath).filePath(title + ".pdf"),
+        "PDF Files (*.pdf)"
+    );
+    if (outputPath.isEmpty()) {
+        return;
+    }
+    
+    // Chapters are laid out and written off the GUI thread; writing can continue meanwhile
+    QProgressDialog* progress = new QProgressDialog("Exporting manuscript...", "Cancel", 0, 0, this);
+    progress->setWindowModality(Qt::NonModal);
+    progress->setMinimumDuration(0);
+    progress->setAttribute(Qt::WA_DeleteOnClose);
+    connect(progress, &QProgressDialog::canceled, m_exporter.get(), &ManuscriptExporter::cancel);
+    connect(m_exporter.get(), &ManuscriptExporter::progressChanged, progress, [progress](int value, int maximum) {
+        progress->setMaximum(maximum);
+        progress->setValue(value);
+    });
+    connect(m_exporter.get(), &ManuscriptExporter::finished, progress, [this, progress](bool success, const QString& message) {
+        progress->close();
+        if (success) {
+            statusBar()->showMessage(message, 5000);
+        } else {
+            QMessageBox::warning(this, "Export Manuscript", message);
+        }
+    });
+    connect(m_exporter.get(), &ManuscriptExporter::cancelled, progress, [this, progress]() {
+        progress->close();
+        statusBar()->showMessage("Export cancelled", 2000);
+    });
+    
+    if (!m_exporter->start(outputPath, snapshot->getChapterPaths(), openEditorTexts(), title, snapshot->getAuthor(),
+                           snapshot->isComputedHeadingNumbering())) {
+        progress->close();
+        QMessageBox::warning(this, "Export Manuscript", "The project has no chapters to export.");
+    }
+}
+
+void MainWindow::showChapterPosition(const QString& chapterPath, int position, int length)
+{
+    // Same route as opening the chapter from the project tree
+    openChapterFile(chapterPath);
+    if (EditorWidget* editor = m_documentRegistry->editorForPath(chapterPath)) {
+        editor->goToPosition(position, length);
+    }
+}
+
+QHash<QString, QString> MainWindow::openEditorTexts() const
+{
+    // Open chapters are analyzed as shown, not as last saved
+    QHash<QString, QString> texts;
+    const QList<EditorWidget*> editors = m_documentRegistry->editors();
+    for (EditorWidget* editor : editors) {
+        texts.insert(m_documentRegistry->pathForEditor(editor), editor->getContent());
+    }
+    
+    return texts;
+}
+
+CharacterDatabase* MainWindow::characterDatabaseFor(const QString& characterId) const
+{
+    // Character IDs are UUIDs, so at most one open project has it
+    for (const QString& projectPath : m_workspace->getProjectPaths()) {
+        CharacterDatabase* characters = m_workspace->getProject(projectPath)->getCharacterDatabase();
+        if (!characters->getCharacter(characterId).id.isEmpty()) {
+            return characters;
+        }
+    }
+    
+    return nullptr;
+}
+
+ProjectManager* MainWindow::projectForFile(const QString& filePath) const
+{
+    // Loose files outside every project go with the active one
+    ProjectManager* project = m_workspace->projectForFile(filePath);
+    return project ? project : m_projectManager;
+}
+
+QStringList MainWindow::chapterFilePaths() const
+{
+    // Same manifest the background jobs see
+    return m_projectManager->getSnapshot()->getChapterPaths();
+}
+
 void MainWindow::openChapterFile(const QString& filePath)
 {
     // Check if already open
-    if (m_openEditors.contains(filePath)) {
-        // Switch to existing tab
-        EditorWidget* existingEditor = m_openEditors[filePath];
-        for (int i = 0; i < m_centerPane->count(); ++i) {
-            if (m_centerPane->widget(i) == existingEditor) {
-                m_centerPane->setCurrentIndex(i);
-                break;
+    if (EditorWidget* existingEditor = m_documentRegistry->editorForPath(filePath)) {
+        // Switch to the existing tab or raise its detached window
+        QWidget* container = m_documentRegistry->containerForEditor(existingEditor);
+        if (QTabWidget* tabWidget = qobject_cast<QTabWidget*>(container)) {
+            int tabIndex = m_documentRegistry->tabIndexForEditor(existingEditor);
+            if (tabIndex >= 0) {
+                tabWidget->setCurrentIndex(tabIndex);
             }
+        } else if (ScriveningView* view = qobject_cast<ScriveningView*>(container)) {
+            m_centerPane->setCurrentWidget(view);
+            view->scrollToChapter(filePath);
+        } else if (container) {
+            container->raise();
+            container->activateWindow();
         }
         return;
     }
@@ -761,28 +1450,13 @@ void MainWindow::openChapterFile(const QString& filePath)
         QFileInfo fileInfo(filePath);
         QString tabName = fileInfo.baseName();
         
-        // Connect content change signal for tab indicators
-        connect(editor, &EditorWidget::contentChanged, this, [this, editor]() {
-            // Find the tab index for this editor
-            for (int i = 0; i < m_centerPane->count(); ++i) {
-                if (m_centerPane->widget(i) == editor) {
-                    updateTabIndicator(editor, i);
-                    break;
-                }
-            }
-        });
-        
-        // Add to center pane
+        // Add to center pane and track the editor
+        trackEditor(editor, filePath, m_centerPane);
         int tabIndex = m_centerPane->addTab(editor, tabName);
         m_centerPane->setCurrentIndex(tabIndex);
         
-        // Track the editor with auto-save
-        m_openEditors[filePath] = editor;
-        m_currentEditor = editor;
-        m_autoSaveManager->registerEditor(editor, filePath);
-        
         // Update tab indicator
-        updateTabIndicator(editor, tabIndex);
+        updateTabIndicator(editor);
         
         statusBar()->showMessage("Opened: " + tabName, 2000);
     } else {
@@ -793,12 +1467,9 @@ void MainWindow::openChapterFile(const QString& filePath)
 
 void MainWindow::onChapterCreatedFromTree(const QString& projectPath, const QString& chapterName)
 {
-    // Set the project as current if it's not already
+    // Make the project active if it's not already; the switch updates all per-project state
     if (m_currentProjectPath != projectPath) {
-        m_currentProjectPath = projectPath;
-        QString projectName = QFileInfo(projectPath).baseName();
-        updateWindowTitle(projectName);
-        m_projectStatusLabel->setText(QString("Project: %1").arg(projectName));
+        m_workspace->setActiveProject(projectPath);
     }
     
     // Create the chapter using existing logic
@@ -812,31 +1483,19 @@ void MainWindow::onChapterCreatedFromTree(const QString& projectPath, const QStr
     // Add initial content
     editor->setContent("# " + chapterName + "\n\nBegin writing here...\n");
     
-    // Connect content change signal for tab indicators
-    connect(editor, &EditorWidget::contentChanged, this, [this, editor]() {
-        // Find the tab index for this editor
-        for (int i = 0; i < m_centerPane->count(); ++i) {
-            if (m_centerPane->widget(i) == editor) {
-                updateTabIndicator(editor, i);
-                break;
-            }
-        }
-    });
-    
-    // Add to center pane
+    // Add to center pane and track the editor
+    trackEditor(editor, chapterPath, m_centerPane);
     int tabIndex = m_centerPane->addTab(editor, chapterName);
     m_centerPane->setCurrentIndex(tabIndex);
     
-    // Track the editor with auto-save
-    m_openEditors[chapterPath] = editor;
-    m_currentEditor = editor;
-    m_autoSaveManager->registerEditor(editor, chapterPath);
-    
-    // Save immediately
+    // Save immediately and append it to the chapter order
     editor->saveToFile(chapterPath);
+    if (ProjectManager* project = m_workspace->getProject(projectPath)) {
+        project->addChapterToOrder(chapterPath);
+    }
     
     // Update tab indicator after save
-    updateTabIndicator(editor, tabIndex);
+    updateTabIndicator(editor);
     
     // Refresh the project tree
     m_projectTree->refreshProject(projectPath);
@@ -846,14 +1505,33 @@ void MainWindow::onChapterCreatedFromTree(const QString& projectPath, const QStr
 
 void MainWindow::onTabDetached(QWidget* widget, const QString& label, const QPoint& globalPos)
 {
-    // For now, just show a message about the detachment
-    // In a future implementation, we'll create a floating window
-    QMessageBox::information(this, "Tab Detached", 
-                            QString("Tab '%1' was detached at position (%2, %3)")
-                            .arg(label).arg(globalPos.x()).arg(globalPos.y()));
+    if (!widget) {
+        return;
+    }
+    
+    // Closing the floating window returns the tab to the pane it came from
+    DraggableTabWidget* sourcePane = qobject_cast<DraggableTabWidget*>(sender());
+    if (!sourcePane) {
+        sourcePane = m_centerPane;
+    }
+    
+    DetachedTabWindow* window = new DetachedTabWindow(widget, label, this);
+    window->setAttribute(Qt::WA_DeleteOnClose);
+    connect(window, &DetachedTabWindow::windowClosed, this,
+            [this, sourcePane](QWidget* contentWidget, const QString& title) {
+                sourcePane->attachTab(contentWidget, title);
+                if (EditorWidget* editor = qobject_cast<EditorWidget*>(contentWidget)) {
+                    updateTabIndicator(editor);
+                }
+            });
     
-    // For now, reattach to center pane
-    m_centerPane->attachTab(widget, label);
+    m_documentRegistry->updateContainer(widget, window);
+    if (EditorWidget* editor = qobject_cast<EditorWidget*>(widget)) {
+        updateTabIndicator(editor);
+    }
+    
+    window->move(globalPos);
+    window->show();
     
     statusBar()->showMessage("Tab detached: " + label, 2000);
 }
@@ -863,18 +1541,23 @@ void MainWindow::onTabAttachRequested(QWidget* widget, const QString& label)
     statusBar()->showMessage("Tab reattached: " + label, 2000);
 }
 
-void MainWindow::onTreeItemMoved(const QString& fromPath, const QString& toPath, int itemType)
+void MainWindow::onTreeItemMoved(const QString& fromPath, const QString& toPath, int itemType, const QString& projectPath)
 {
     // Handle different item types
     if (itemType == ProjectTreeWidget::ChapterItem) {
         int fromIndex = fromPath.toInt();
         int toIndex = toPath.toInt();
         
-        qDebug() << "MainWindow: Chapter moved from index" << fromIndex << "to" << toIndex;
+        qDebug() << "MainWindow: Chapter moved from index" << fromIndex << "to" << toIndex << "in" << projectPath;
         
-        if (!m_currentProjectPath.isEmpty()) {
+        // The move belongs to the project the chapter sits under, active or not
+        if (m_workspace->getProject(projectPath)) {
             // Trigger the UpdateManager to handle the move
-            if (m_updateManager->moveChapter(m_currentProjectPath, fromIndex, toIndex)) {
+            if (m_updateManager->moveChapter(projectPath, fromIndex, toIndex)) {
+                // Only the active project's order changes are forwarded by the workspace
+                if (projectPath != m_currentProjectPath) {
+                    applyHeadingNumberingToAll();
+                }
                 statusBar()->showMessage("Chapters reordered successfully", 2000);
             } else {
                 statusBar()->showMessage("Failed to reorder chapters", 2000);
@@ -889,6 +1572,10 @@ void MainWindow::onTreeItemRenamed(const QString& oldName, const QString& newNam
 {
     qDebug() << "MainWindow: Item renamed from" << oldName << "to" << newName << "Type:" << itemType;
     
+    // Files are renamed in the project that owns them, which need not be the active one
+    ProjectManager* project = projectForFile(filePath);
+    QString projectPath = project->getCurrentProjectPath();
+    
     // Handle file renaming based on item type
     if (itemType == ProjectTreeWidget::ChapterItem) {
         // Rename the actual chapter file
@@ -900,16 +1587,19 @@ void MainWindow::onTreeItemRenamed(const QString& oldName, const QString& newNam
             qDebug() << "Attempting to rename chapter file:" << filePath << "→" << newFilePath;
             
             if (renameProjectFile(filePath, newFilePath)) {
+                // Keep the chapter's manifest entry (and its stable ID)
+                project->renameChapterInOrder(filePath, newFilePath);
+                
                 // Update any open editor
                 updateOpenEditorPath(filePath, newFilePath);
                 
                 // Refresh the project tree to reflect the file change
-                m_projectTree->refreshProject(m_currentProjectPath);
+                m_projectTree->refreshProject(projectPath);
                 
                 statusBar()->showMessage("Chapter renamed: " + oldName + " → " + newName, 2000);
             } else {
                 // Rename failed, refresh tree to revert the display name
-                m_projectTree->refreshProject(m_currentProjectPath);
+                m_projectTree->refreshProject(projectPath);
                 statusBar()->showMessage("Failed to rename chapter file", 2000);
             }
         } else {
@@ -918,8 +1608,11 @@ void MainWindow::onTreeItemRenamed(const QString& oldName, const QString& newNam
         }
     } 
     else if (itemType == ProjectTreeWidget::CharacterItem) {
-        // Handle character file renaming when implemented
-        statusBar()->showMessage("Character renamed: " + oldName + " → " + newName, 2000);
+        // Character items carry their stable ID in place of a file path
+        CharacterDatabase* characters = characterDatabaseFor(filePath);
+        if (characters && characters->renameCharacter(filePath, newName)) {
+            statusBar()->showMessage("Character renamed: " + oldName + " → " + newName, 2000);
+        }
     }
     else if (itemType == ProjectTreeWidget::ResearchItem) {
         // Handle research file renaming
@@ -934,10 +1627,10 @@ void MainWindow::onTreeItemRenamed(const QString& oldName, const QString& newNam
             
             if (renameProjectFile(filePath, newFilePath)) {
                 updateOpenEditorPath(filePath, newFilePath);
-                m_projectTree->refreshProject(m_currentProjectPath);
+                m_projectTree->refreshProject(projectPath);
                 statusBar()->showMessage("Research file renamed: " + oldName + " → " + newName, 2000);
             } else {
-                m_projectTree->refreshProject(m_currentProjectPath);
+                m_projectTree->refreshProject(projectPath);
                 statusBar()->showMessage("Failed to rename research file", 2000);
             }
         }
@@ -945,31 +1638,58 @@ void MainWindow::onTreeItemRenamed(const QString& oldName, const QString& newNam
     else {
         statusBar()->showMessage("Item renamed: " + oldName + " → " + newName, 2000);
     }
-    
-    // Update any open tabs with the old name (for display purposes)
-    for (int i = 0; i < m_centerPane->count(); ++i) {
-        QWidget* widget = m_centerPane->widget(i);
-        EditorWidget* editor = qobject_cast<EditorWidget*>(widget);
-        
-        if (editor) {
-            QString currentTabText = m_centerPane->tabText(i);
-            // Remove change indicator to get base name
-            QString baseTabName = currentTabText;
-            baseTabName.remove(" •");
-            
-            if (baseTabName == oldName) {
-                // Update the tab with new name, preserving change indicator if present
-                if (editor->hasUnsavedChanges()) {
-                    m_centerPane->setTabText(i, newName + " •");
-                } else {
-                    m_centerPane->setTabText(i, newName);
-                }
-                qDebug() << "Updated tab text from" << oldName << "to" << newName;
-            }
+}
+
+void MainWindow::onTreeItemDeleted(const QString& path, int itemType)
+{
+    if (itemType == ProjectTreeWidget::CharacterItem) {
+        CharacterDatabase* characters = characterDatabaseFor(path);
+        if (characters && characters->removeCharacter(path)) {
+            statusBar()->showMessage("Character deleted", 2000);
         }
     }
 }
 
+void MainWindow::onCharacterCreatedFromTree(const QString& projectPath, const QString& characterName)
+{
+    ProjectManager* project = m_workspace->getProject(projectPath);
+    if (!project) {
+        statusBar()->showMessage("Characters can only be added to an open project", 2000);
+        return;
+    }
+    
+    CharacterDatabase* characters = project->getCharacterDatabase();
+    if (!characters->findCharacterId(characterName).isEmpty()) {
+        statusBar()->showMessage("Character already exists: " + characterName, 2000);
+        return;
+    }
+    
+    characters->addCharacter(characterName);
+    statusBar()->showMessage("Character created: " + characterName, 2000);
+}
+
+void MainWindow::onCharacterAliasesEditRequested(const QString& projectPath, const QString& characterId)
+{
+    ProjectManager* project = m_workspace->getProject(projectPath);
+    if (!project) {
+        return;
+    }
+    
+    CharacterDatabase* characters = project->getCharacterDatabase();
+    CharacterRecord record = characters->getCharacter(characterId);
+    if (record.id.isEmpty()) {
+        return;
+    }
+    
+    bool ok;
+    QString aliases = QInputDialog::getText(this, "Edit Aliases",
+                                            QString("Aliases for %1 (comma separated):").arg(record.name),
+                                            QLineEdit::Normal, record.aliases.join(", "), &ok);
+    if (ok) {
+        characters->setAliases(characterId, aliases.split(',', Qt::SkipEmptyParts));
+    }
+}
+
 void MainWindow::closeEvent(QCloseEvent* event)
 {
     // Save all files before closing to prevent data loss
@@ -977,6 +1697,17 @@ void MainWindow::closeEvent(QCloseEvent* event)
         m_autoSaveManager->saveAllOnExit();
     }
     
+    // Large files save in the background; stay open if any of them failed to land
+    bool allSaved = true;
+    const QList<EditorWidget*> editors = m_documentRegistry->editors();
+    for (EditorWidget* editor : editors) {
+        allSaved = editor->waitForSave() && allSaved;
+    }
+    if (!allSaved) {
+        event->ignore();
+        return;
+    }
+    
     // Check for unsaved project changes
     if (m_projectModified) {
         int ret = QMessageBox::question(this, "Unsaved Project Changes", 
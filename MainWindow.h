@@ -19,15 +19,35 @@
 #include <QKeySequence>
 #include <QLabel>
 #include <QCloseEvent>
+#include <QHash>
 #include <memory>
 
 class ProjectManager;
+class CharacterDatabase;
+class Workspace;
 class EditorWidget;
 class PaneManager;
 class ProjectTreeWidget;
 class AutoSaveManager;
 class DraggableTabWidget;
 class UpdateManager;
+class DocumentRegistry;
+class DocumentStateService;
+class CharacterMentionIndex;
+class NameConsistencyChecker;
+class NameConsistencyPanel;
+class WordFrequencyAnalyzer;
+class WordFrequencyPanel;
+class RepeatedPhraseDetector;
+class RepeatedPhrasePanel;
+class StatisticsPanel;
+class StyleRuleSet;
+class SessionRecorder;
+class SessionDashboard;
+class ManuscriptPaginator;
+class ManuscriptExporter;
+class ScriveningView;
+class VisibilityTracker;
 
 class MainWindow : public QMainWindow
 {
@@ -55,14 +75,20 @@ private slots:
     void convertPaneToTab();
     void splitHorizontal();
     void splitVertical();
-    void onProjectOpened(const QString& projectName);
+    void onActiveProjectChanged(const QString& projectPath);
     void onChapterTabChanged(int index);
     void onChapterTabCloseRequested(int index);
     void onChapterCreatedFromTree(const QString& projectPath, const QString& chapterName);
     void onTabDetached(QWidget* widget, const QString& label, const QPoint& globalPos);
     void onTabAttachRequested(QWidget* widget, const QString& label);
-    void onTreeItemMoved(const QString& fromPath, const QString& toPath, int itemType);
+    void onTreeItemMoved(const QString& fromPath, const QString& toPath, int itemType, const QString& projectPath);
     void onTreeItemRenamed(const QString& oldName, const QString& newName, int itemType, const QString& filePath);
+    void onTreeItemDeleted(const QString& path, int itemType);
+    void onCharacterCreatedFromTree(const QString& projectPath, const QString& characterName);
+    void onCharacterAliasesEditRequested(const QString& projectPath, const QString& characterId);
+    void openCorkboard(const QString& boardPath);
+    void exportManuscript();
+    void openScrivenings();
 
 private:
     void setupUI();
@@ -74,8 +100,27 @@ private:
     void openChapterFile(const QString& filePath);
     
     // Change indicator methods
-    void updateTabIndicator(EditorWidget* editor, int tabIndex);
+    void updateTabIndicator(EditorWidget* editor);
     void updateAllTabIndicators();
+    void trackEditor(EditorWidget* editor, const QString& filePath, QWidget* container);
+    void applyHeadingNumbering(EditorWidget* editor);
+    void applyHeadingNumberingToAll();
+    void rebuildMentionIndex();
+    void checkNameConsistency();
+    void applyNameIssues(EditorWidget* editor);
+    void analyzeWordFrequency();
+    void detectRepeatedPhrases();
+    void paginateManuscript();
+    void parkAnalysis(ProjectManager* project);
+    bool restoreAnalysis(ProjectManager* project);
+    void showChapterPosition(const QString& chapterPath, int position, int length);
+    void updateStatisticsPanel();
+    void loadStyleRules();
+    void refreshSessionDashboard();
+    QStringList chapterFilePaths() const;
+    ProjectManager* projectForFile(const QString& filePath) const;
+    CharacterDatabase* characterDatabaseFor(const QString& characterId) const;
+    QHash<QString, QString> openEditorTexts() const;
     
     // File operations
     QString createSafeFileName(const QString& name) const;
@@ -92,16 +137,34 @@ private:
     DraggableTabWidget* m_rightPane;    // Word references
     
     // Managers
-    std::unique_ptr<ProjectManager> m_projectManager;
+    std::unique_ptr<Workspace> m_workspace;
+    ProjectManager* m_projectManager;   // Active project, owned by m_workspace
     std::unique_ptr<PaneManager> m_paneManager;
     std::unique_ptr<AutoSaveManager> m_autoSaveManager;
     std::unique_ptr<UpdateManager> m_updateManager;
+    std::unique_ptr<DocumentRegistry> m_documentRegistry;
+    std::unique_ptr<DocumentStateService> m_documentState;
+    std::unique_ptr<CharacterMentionIndex> m_mentionIndex;
+    std::unique_ptr<NameConsistencyChecker> m_nameChecker;
+    std::unique_ptr<WordFrequencyAnalyzer> m_wordFrequency;
+    std::unique_ptr<RepeatedPhraseDetector> m_phraseDetector;
+    std::unique_ptr<SessionRecorder> m_sessionRecorder;
+    std::unique_ptr<ManuscriptPaginator> m_paginator;
+    std::unique_ptr<ManuscriptExporter> m_exporter;
+    std::unique_ptr<VisibilityTracker> m_visibilityTracker;
     
     // Custom widgets
     ProjectTreeWidget* m_projectTree;
+    NameConsistencyPanel* m_namePanel;
+    WordFrequencyPanel* m_wordFrequencyPanel;
+    RepeatedPhrasePanel* m_phrasePanel;
+    StatisticsPanel* m_statisticsPanel;
+    SessionDashboard* m_sessionDashboard;
+    ScriveningView* m_scriveningView;   // Null until opened
     
     // Status bar components
     QLabel* m_projectStatusLabel;
+    QLabel* m_wakeupLabel;
     
     // Menu actions
     QAction* m_newProjectAction;
@@ -116,13 +179,15 @@ private:
     QAction* m_selectFontAction;
     QAction* m_splitHorizontalAction;
     QAction* m_splitVerticalAction;
+    QAction* m_computedNumberingAction;
+    QAction* m_styleLintingAction;
     
     // Current project state
     QString m_currentProjectPath;
     bool m_projectModified;
+    std::shared_ptr<const StyleRuleSet> m_styleRules;  // Null while linting is off
     
-    // Document management
-    QHash<QString, EditorWidget*> m_openEditors;  // filename -> editor
+    // Document management (open editors live in m_documentRegistry)
     EditorWidget* m_currentEditor;
 };
 
@@ -0,0 +1,283 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "ManuscriptExporter.h"
+#include "ManuscriptPaginator.h"
+#include "TaskScheduler.h"
+#include "UpdateManager.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+#include <QTextDocument>
+#include <QTextCursor>
+#include <QTextBlockFormat>
+#include <QPainter>
+#include <QPdfWriter>
+#include <QPageSize>
+#include <QDebug>
+
+namespace {
+
+qreal textWidth()
+{
+    return ManuscriptPaginator::PAGE_WIDTH - 2 * ManuscriptPaginator::MARGIN;
+}
+
+qreal textPageHeight()
+{
+    // Whole lines only, so a line is never cut by the page edge
+    return ManuscriptPaginator::linesPerPage() * ManuscriptPaginator::lineHeight();
+}
+
+}
+
+ManuscriptExporter::ManuscriptExporter(QObject *parent)
+    : QObject(parent)
+    , m_chapterCount(0)
+    , m_pageCount(0)
+    , m_layoutWatcher(nullptr)
+    , m_writeWatcher(nullptr)
+{
+}
+
+ManuscriptExporter::~ManuscriptExporter()
+{
+    if (m_layoutWatcher) {
+        m_layoutWatcher->cancel();
+        m_layoutWatcher->waitForFinished();
+    }
+    if (m_writeWatcher) {
+        m_writeWatcher->cancel();
+        m_writeWatcher->waitForFinished();
+    }
+}
+
+bool ManuscriptExporter::start(const QString& outputPath, const QStringList& chapterPaths,
+                               const QHash<QString, QString>& openTexts, const QString& title, const QString& author,
+                               bool computedNumbering)
+{
+    if (isExporting() || chapterPaths.isEmpty()) {
+        return false;
+    }
+    
+    m_outputPath = outputPath;
+    m_title = title;
+    m_author = author;
+    m_chapterCount = chapterPaths.size();
+    m_pageCount = 0;
+    emit progressChanged(0, m_chapterCount * 2);
+    
+    // Chapter numbers follow the manuscript order; workers only see their own chapter
+    QHash<QString, int> chapterNumbers;
+    if (computedNumbering) {
+        for (int i = 0; i < chapterPaths.size(); ++i) {
+            chapterNumbers.insert(chapterPaths[i], i + 1);
+        }
+    }
+    
+    // Each worker builds and lays out its own chapter document
+    m_layoutWatcher = new QFutureWatcher<ChapterPages>(this);
+    connect(m_layoutWatcher, &QFutureWatcherBase::progressValueChanged, this, [this](int value) {
+        emit progressChanged(value, m_chapterCount * 2);
+    });
+    connect(m_layoutWatcher, &QFutureWatcherBase::finished, this, &ManuscriptExporter::onLayoutFinished);
+    m_layoutWatcher->setFuture(TaskScheduler::instance()->mapped(TaskScheduler::AnalysisLane, "export:layout", chapterPaths, [openTexts, chapterNumbers](const QString& chapterPath) {
+        int chapterNumber = chapterNumbers.value(chapterPath, 0);
+        auto openText = openTexts.constFind(chapterPath);
+        if (openText != openTexts.constEnd()) {
+            return layoutChapter(chapterPath, *openText, chapterNumber);
+        }
+        
+        QFile file(chapterPath);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            qDebug() << "Cannot export chapter:" << chapterPath;
+            return layoutChapter(chapterPath, QString(), chapterNumber);
+        }
+        QTextStream in(&file);
+        return layoutChapter(chapterPath, in.readAll(), chapterNumber);
+    }));
+    
+    return true;
+}
+
+void ManuscriptExporter::cancel()
+{
+    if (m_layoutWatcher) {
+        m_layoutWatcher->cancel();
+    }
+    if (m_writeWatcher) {
+        m_writeWatcher->cancel();
+    }
+}
+
+void ManuscriptExporter::onLayoutFinished()
+{
+    QFutureWatcher<ChapterPages>* watcher = m_layoutWatcher;
+    m_layoutWatcher = nullptr;
+    watcher->deleteLater();
+    
+    if (watcher->isCanceled()) {
+        emit cancelled();
+        return;
+    }
+    
+    // mapped() keeps input order, which is the manuscript order
+    const QList<ChapterPages> chapters = watcher->future().results();
+    for (const ChapterPages& chapter : chapters) {
+        m_pageCount += chapter.pages.size();
+    }
+    
+    m_writeWatcher = new QFutureWatcher<QString>(this);
+    connect(m_writeWatcher, &QFutureWatcherBase::progressValueChanged, this, [this](int value) {
+        emit progressChanged(value, m_chapterCount * 2);
+    });
+    connect(m_writeWatcher, &QFutureWatcherBase::finished, this, &ManuscriptExporter::onWriteFinished);
+    m_writeWatcher->setFuture(TaskScheduler::instance()->runWithPromise<QString>(TaskScheduler::SaveLane, "export:write",
+        [outputPath = m_outputPath, chapters, title = m_title, author = m_author,
+         chapterCount = m_chapterCount](QPromise<QString>& promise) {
+            writePdf(promise, outputPath, chapters, title, author, chapterCount);
+        }));
+}
+
+void ManuscriptExporter::onWriteFinished()
+{
+    QFutureWatcher<QString>* watcher = m_writeWatcher;
+    m_writeWatcher = nullptr;
+    watcher->deleteLater();
+    
+    if (watcher->isCanceled()) {
+        QFile::remove(m_outputPath);
+        emit cancelled();
+        return;
+    }
+    
+    QString error = watcher->future().resultCount() > 0 ? watcher->result() : QString("Export failed");
+    if (!error.isEmpty()) {
+        emit finished(false, error);
+        return;
+    }
+    
+    emit progressChanged(m_chapterCount * 2, m_chapterCount * 2);
+    emit finished(true, QString("Exported %1 pages to %2").arg(m_pageCount).arg(QFileInfo(m_outputPath).fileName()));
+}
+
+ManuscriptExporter::ChapterPages ManuscriptExporter::layoutChapter(const QString& chapterPath, const QString& text, int chapterNumber)
+{
+    ChapterPages result;
+    result.chapterPath = chapterPath;
+    
+    QTextDocument document;
+    document.setDocumentMargin(0);
+    document.setDefaultFont(ManuscriptPaginator::manuscriptFont());
+    document.setPageSize(QSizeF(textWidth(), textPageHeight()));
+    
+    QTextBlockFormat bodyFormat;
+    bodyFormat.setLineHeight(200, QTextBlockFormat::ProportionalHeight);
+    bodyFormat.setTextIndent(ManuscriptPaginator::PARAGRAPH_INDENT);
+    QTextBlockFormat centeredFormat = bodyFormat;
+    centeredFormat.setTextIndent(0);
+    centeredFormat.setAlignment(Qt::AlignHCenter);
+    QTextBlockFormat openingFormat = centeredFormat;
+    openingFormat.setTopMargin(ManuscriptPaginator::CHAPTER_DROP_LINES * ManuscriptPaginator::lineHeight());
+    
+    // Same block rules as the paginator: "#" titles, "##" scene breaks, or numbered
+    // subsection headings when the project computes its numbering
+    const bool numbered = chapterNumber > 0;
+    QTextCursor cursor(&document);
+    const QStringList lines = (numbered ? UpdateManager::renderNumberedContent(text, chapterNumber) : text).split('\n');
+    bool first = true;
+    auto addBlock = [&cursor, &first](const QTextBlockFormat& format, const QString& blockText) {
+        if (first) {
+            cursor.setBlockFormat(format);
+            first = false;
+        } else {
+            cursor.insertBlock(format);
+        }
+        cursor.insertText(blockText);
+    };
+    
+    for (const QString& line : lines) {
+        QString trimmed = line.trimmed();
+        if (trimmed.isEmpty()) {
+            continue;
+        }
+        
+        if (trimmed.startsWith("# ")) {
+            addBlock(first ? openingFormat : centeredFormat, trimmed.mid(2).trimmed());
+        } else {
+            if (first) {
+                addBlock(openingFormat, QFileInfo(chapterPath).completeBaseName().replace('_', ' '));
+            }
+            if (trimmed.startsWith("## ")) {
+                addBlock(centeredFormat, numbered ? trimmed.mid(3).trimmed() : QString("#"));
+            } else {
+                addBlock(bodyFormat, trimmed);
+            }
+        }
+    }
+    
+    // Record each page; the document itself is dropped when this returns
+    const qreal pageHeight = textPageHeight();
+    const int pageCount = document.pageCount();
+    for (int page = 0; page < pageCount; ++page) {
+        QPicture picture;
+        QPainter painter(&picture);
+        painter.translate(0, -page * pageHeight);
+        document.drawContents(&painter, QRectF(0, page * pageHeight, textWidth(), pageHeight));
+        painter.end();
+        result.pages.append(picture);
+    }
+    
+    return result;
+}
+
+void ManuscriptExporter::writePdf(QPromise<QString>& promise, const QString& outputPath, const QList<ChapterPages>& chapters,
+                                  const QString& title, const QString& author, int progressOffset)
+{
+    promise.setProgressRange(0, progressOffset + chapters.size());
+    
+    QPdfWriter writer(outputPath);
+    writer.setPageSize(QPageSize(QPageSize::Letter));
+    writer.setPageMargins(QMarginsF(0, 0, 0, 0));
+    writer.setResolution(72);   // One unit per point, matching the page model
+    writer.setTitle(title);
+    writer.setCreator("NeuroDraft");
+    
+    QPainter painter;
+    if (!painter.begin(&writer)) {
+        promise.addResult(QString("Cannot write %1").arg(outputPath));
+        return;
+    }
+    
+    // Standard running header: Surname / TITLE / page
+    const QString surname = author.trimmed().section(' ', -1);
+    const QString headerPrefix = surname.isEmpty() ? title.toUpper() : QString("%1 / %2").arg(surname, title.toUpper());
+    const QRectF headerRect(ManuscriptPaginator::MARGIN, ManuscriptPaginator::MARGIN / 2,
+                            textWidth(), ManuscriptPaginator::MARGIN / 2);
+    painter.setFont(ManuscriptPaginator::manuscriptFont());
+    
+    int pageNumber = 0;
+    for (int i = 0; i < chapters.size(); ++i) {
+        for (const QPicture& page : chapters[i].pages) {
+            if (promise.isCanceled()) {
+                painter.end();
+                return;
+            }
+            if (pageNumber > 0) {
+                writer.newPage();
+            }
+            ++pageNumber;
+            
+            painter.drawText(headerRect, Qt::AlignRight | Qt::AlignVCenter,
+                             QString("%1 / %2").arg(headerPrefix).arg(pageNumber));
+            painter.drawPicture(QPointF(ManuscriptPaginator::MARGIN, ManuscriptPaginator::MARGIN), page);
+        }
+        promise.setProgressValue(progressOffset + i + 1);
+    }
+    
+    painter.end();
+    promise.addResult(QString());
+}
@@ -0,0 +1,68 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef MANUSCRIPTEXPORTER_H
+#define MANUSCRIPTEXPORTER_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QList>
+#include <QPicture>
+#include <QFutureWatcher>
+#include <QPromise>
+
+// Exports the manuscript to PDF in the ManuscriptPaginator page format.
+// Chapters are laid out in parallel, each in its own QTextDocument, and
+// recorded as one QPicture per page; a final task replays the pages in
+// order into QPdfWriter with the running header. Nothing runs on the GUI
+// thread and the book never exists as a single document.
+class ManuscriptExporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ManuscriptExporter(QObject *parent = nullptr);
+    ~ManuscriptExporter();
+
+    // openTexts supplies unsaved editor content by chapter path; with computedNumbering
+    // headings are numbered by manuscript position, as the editor shows them
+    bool start(const QString& outputPath, const QStringList& chapterPaths,
+               const QHash<QString, QString>& openTexts, const QString& title, const QString& author,
+               bool computedNumbering = false);
+    void cancel();
+    bool isExporting() const { return m_layoutWatcher || m_writeWatcher; }
+
+signals:
+    void progressChanged(int value, int maximum);   // Chapters laid out, then chapters written
+    void finished(bool success, const QString& message);
+    void cancelled();
+
+private slots:
+    void onLayoutFinished();
+    void onWriteFinished();
+
+private:
+    struct ChapterPages {
+        QString chapterPath;
+        QList<QPicture> pages;
+    };
+
+    static ChapterPages layoutChapter(const QString& chapterPath, const QString& text, int chapterNumber);   // 0: unnumbered
+    static void writePdf(QPromise<QString>& promise, const QString& outputPath, const QList<ChapterPages>& chapters,
+                         const QString& title, const QString& author, int progressOffset);
+
+    QString m_outputPath;
+    QString m_title;
+    QString m_author;
+    int m_chapterCount;
+    int m_pageCount;
+    QFutureWatcher<ChapterPages>* m_layoutWatcher;   // Non-null while chapters are laid out
+    QFutureWatcher<QString>* m_writeWatcher;         // Non-null while the PDF is written; yields an error or ""
+};
+
+#endif // MANUSCRIPTEXPORTER_H
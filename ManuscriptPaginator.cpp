@@ -0,0 +1,329 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "ManuscriptPaginator.h"
+#include "TaskScheduler.h"
+#include <QFile>
+#include <QTextStream>
+#include <QTextLayout>
+#include <QFontMetricsF>
+#include <QStringView>
+#include <QDebug>
+#include <utility>
+
+namespace {
+
+struct PagePosition {
+    int page = 0;
+    int line = ManuscriptPaginator::CHAPTER_DROP_LINES;
+};
+
+// Advances past a block of the given height, keeping at least two lines
+// of a paragraph together at the bottom and top of a page
+PagePosition placeBlock(PagePosition position, int lines, int linesPerPage)
+{
+    if (lines <= 0) {
+        return position;
+    }
+    
+    int remaining = linesPerPage - position.line;
+    if (lines > 1 && remaining == 1) {
+        ++position.page;
+        position.line = 0;
+        remaining = linesPerPage;
+    }
+    
+    if (lines <= remaining) {
+        position.line += lines;
+        return position;
+    }
+    
+    int carried = lines - remaining;
+    if (carried == 1 && remaining > 1) {
+        carried = 2;   // Widow: pull a second line over with it
+    }
+    
+    ++position.page;
+    while (carried > linesPerPage) {
+        ++position.page;
+        carried -= linesPerPage;
+    }
+    position.line = carried;
+    return position;
+}
+
+}
+
+ManuscriptPaginator::ManuscriptPaginator(QObject *parent)
+    : QObject(parent)
+    , m_pass(this)
+{
+}
+
+ManuscriptPaginator::~ManuscriptPaginator() = default;
+
+QFont ManuscriptPaginator::manuscriptFont()
+{
+    // Pixel size in a 72 dpi model, so one unit is one point on paper
+    QFont font("Courier");
+    font.setStyleHint(QFont::TypeWriter);
+    font.setPixelSize(12);
+    return font;
+}
+
+qreal ManuscriptPaginator::lineHeight()
+{
+    return QFontMetricsF(manuscriptFont()).lineSpacing() * 2.0;
+}
+
+int ManuscriptPaginator::linesPerPage()
+{
+    return qMax(1, static_cast<int>((PAGE_HEIGHT - 2 * MARGIN) / lineHeight()));
+}
+
+void ManuscriptPaginator::paginate(const QStringList& chapterPaths, const QHash<QString, QString>& openTexts)
+{
+    m_chapterOrder = chapterPaths;
+    
+    // Forget chapters that left the manuscript
+    const QSet<QString> current(chapterPaths.cbegin(), chapterPaths.cend());
+    for (auto it = m_chapters.begin(); it != m_chapters.end();) {
+        it = current.contains(it.key()) ? std::next(it) : m_chapters.erase(it);
+    }
+    
+    for (const QString& chapterPath : chapterPaths) {
+        auto openText = openTexts.constFind(chapterPath);
+        if (openText != openTexts.constEnd()) {
+            m_queuedTexts.insert(chapterPath, *openText);
+            m_queuedFiles.remove(chapterPath);
+        } else if (!m_queuedTexts.contains(chapterPath)) {
+            m_queuedFiles.insert(chapterPath);
+        }
+    }
+    
+    startQueued();
+    emit pageCountsChanged();
+}
+
+void ManuscriptPaginator::paginateText(const QString& chapterPath, const QString& text)
+{
+    if (!m_chapterOrder.contains(chapterPath)) {
+        return;
+    }
+    
+    m_queuedTexts.insert(chapterPath, text);
+    m_queuedFiles.remove(chapterPath);
+    startQueued();
+}
+
+void ManuscriptPaginator::clear()
+{
+    m_pass.stop();
+    m_chapterOrder.clear();
+    m_chapters.clear();
+    m_queuedTexts.clear();
+    m_queuedFiles.clear();
+    emit pageCountsChanged();
+}
+
+ManuscriptPaginator::Results ManuscriptPaginator::takeResults()
+{
+    m_pass.stop();
+    m_queuedTexts.clear();
+    m_queuedFiles.clear();
+    
+    Results results;
+    results.chapterOrder = std::exchange(m_chapterOrder, {});
+    results.chapters = std::exchange(m_chapters, {});
+    return results;
+}
+
+void ManuscriptPaginator::restoreResults(Results results)
+{
+    m_pass.stop();
+    m_queuedTexts.clear();
+    m_queuedFiles.clear();
+    
+    m_chapterOrder = std::move(results.chapterOrder);
+    m_chapters = std::move(results.chapters);
+    emit pageCountsChanged();
+}
+
+qint64 ManuscriptPaginator::Results::estimateMemoryUsage() const
+{
+    qint64 bytes = 0;
+    for (const std::shared_ptr<const ChapterPagination>& chapter : chapters) {
+        bytes += sizeof(ChapterPagination) + chapter->blocks.size() * static_cast<qint64>(sizeof(PaginatedBlock));
+    }
+    
+    return bytes;
+}
+
+void ManuscriptPaginator::startQueued()
+{
+    // One pass at a time; anything queued meanwhile runs against its result
+    if (m_pass.isRunning() || (m_queuedTexts.isEmpty() && m_queuedFiles.isEmpty())) {
+        return;
+    }
+    
+    QList<Job> jobs;
+    jobs.reserve(m_queuedTexts.size() + m_queuedFiles.size());
+    for (auto it = m_queuedTexts.constBegin(); it != m_queuedTexts.constEnd(); ++it) {
+        jobs.append({it.key(), it.value(), true, m_chapters.value(it.key())});
+    }
+    for (const QString& chapterPath : std::as_const(m_queuedFiles)) {
+        jobs.append({chapterPath, QString(), false, m_chapters.value(chapterPath)});
+    }
+    m_queuedTexts.clear();
+    m_queuedFiles.clear();
+    
+    m_pass.start(TaskScheduler::instance()->mapped(TaskScheduler::IndexLane, "pagination", jobs,
+                                                   &ManuscriptPaginator::paginateJob),
+                 [this]() { onPaginationFinished(); });
+}
+
+void ManuscriptPaginator::onPaginationFinished()
+{
+    QFuture<ChapterPagination> future = m_pass.finish();
+    
+    if (!future.isCanceled()) {
+        const QList<ChapterPagination> results = future.results();
+        for (const ChapterPagination& result : results) {
+            if (m_chapterOrder.contains(result.chapterPath)) {
+                m_chapters.insert(result.chapterPath, std::make_shared<const ChapterPagination>(result));
+            }
+        }
+        emit pageCountsChanged();
+    }
+    
+    startQueued();
+}
+
+ChapterPagination ManuscriptPaginator::paginateJob(const Job& job)
+{
+    if (job.hasText) {
+        return paginateChapter(job.chapterPath, job.text, job.previous.get());
+    }
+    
+    QFile file(job.chapterPath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qDebug() << "Cannot paginate chapter:" << job.chapterPath;
+        ChapterPagination empty;
+        empty.chapterPath = job.chapterPath;
+        return empty;
+    }
+    
+    QTextStream in(&file);
+    return paginateChapter(job.chapterPath, in.readAll(), job.previous.get());
+}
+
+ChapterPagination ManuscriptPaginator::paginateChapter(const QString& chapterPath, const QString& text,
+                                                       const ChapterPagination* previous)
+{
+    ChapterPagination result;
+    result.chapterPath = chapterPath;
+    
+    const QFont font = manuscriptFont();
+    const int pageLines = linesPerPage();
+    const QList<QStringView> blocks = QStringView(text).split(QLatin1Char('\n'));
+    const QList<PaginatedBlock> noBlocks;
+    const QList<PaginatedBlock>& oldBlocks = previous ? previous->blocks : noBlocks;
+    
+    // Everything before the first changed block keeps its place and height
+    qsizetype firstChanged = 0;
+    result.blocks.reserve(blocks.size());
+    while (firstChanged < blocks.size() && firstChanged < oldBlocks.size() &&
+           oldBlocks[firstChanged].hash == qHash(blocks[firstChanged])) {
+        result.blocks.append(oldBlocks[firstChanged]);
+        ++firstChanged;
+    }
+    
+    PagePosition position;
+    if (firstChanged > 0) {
+        const PaginatedBlock& last = result.blocks.last();
+        position.page = last.startPage;
+        position.line = last.startLine;
+        position = placeBlock(position, last.lines, pageLines);
+    }
+    
+    // Later blocks only need re-placing; unchanged text keeps its line count
+    QHash<size_t, int> knownLines;
+    for (qsizetype i = firstChanged; i < oldBlocks.size(); ++i) {
+        knownLines.insert(oldBlocks[i].hash, oldBlocks[i].lines);
+    }
+    
+    for (qsizetype i = firstChanged; i < blocks.size(); ++i) {
+        PaginatedBlock block;
+        block.hash = qHash(blocks[i]);
+        block.startPage = position.page;
+        block.startLine = position.line;
+        
+        auto known = knownLines.constFind(block.hash);
+        if (known != knownLines.constEnd()) {
+            block.lines = *known;
+        } else {
+            QStringView trimmed = blocks[i].trimmed();
+            if (trimmed.isEmpty() || trimmed.startsWith(QLatin1String("# "))) {
+                block.lines = 0;   // Blank lines and the chapter title sit in the opening drop
+            } else if (trimmed.startsWith(QLatin1String("## "))) {
+                block.lines = 1;   // Subsections become a centered scene break
+            } else {
+                block.lines = layoutLines(trimmed.toString(), font);
+            }
+        }
+        
+        position = placeBlock(position, block.lines, pageLines);
+        result.blocks.append(block);
+    }
+    
+    for (const PaginatedBlock& block : std::as_const(result.blocks)) {
+        result.lineCount += block.lines;
+    }
+    result.pageCount = position.page + 1;
+    return result;
+}
+
+int ManuscriptPaginator::layoutLines(const QString& block, const QFont& font)
+{
+    const qreal textWidth = PAGE_WIDTH - 2 * MARGIN;
+    
+    QTextLayout layout(block, font);
+    QTextOption option;
+    option.setWrapMode(QTextOption::WrapAtWordBoundaryOrAnywhere);
+    layout.setTextOption(option);
+    
+    int lines = 0;
+    layout.beginLayout();
+    for (QTextLine line = layout.createLine(); line.isValid(); line = layout.createLine()) {
+        line.setLineWidth(lines == 0 ? textWidth - PARAGRAPH_INDENT : textWidth);
+        ++lines;
+    }
+    layout.endLayout();
+    
+    return lines;
+}
+
+int ManuscriptPaginator::getPageCount(const QString& chapterPath) const
+{
+    std::shared_ptr<const ChapterPagination> chapter = m_chapters.value(chapterPath);
+    return chapter ? chapter->pageCount : -1;
+}
+
+int ManuscriptPaginator::getLineCount(const QString& chapterPath) const
+{
+    std::shared_ptr<const ChapterPagination> chapter = m_chapters.value(chapterPath);
+    return chapter ? chapter->lineCount : -1;
+}
+
+int ManuscriptPaginator::getTotalPages() const
+{
+    int total = 0;
+    for (const QString& chapterPath : m_chapterOrder) {
+        total += qMax(0, getPageCount(chapterPath));
+    }
+    
+    return total;
+}
@@ -0,0 +1,110 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef MANUSCRIPTPAGINATOR_H
+#define MANUSCRIPTPAGINATOR_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QSet>
+#include <QList>
+#include <QFont>
+#include <memory>
+#include "TaskWatcher.h"
+
+struct PaginatedBlock {
+    size_t hash;       // Block text hash, for reuse on the next pass
+    int lines;         // Laid-out lines; 0 for blank and chapter-heading blocks
+    int startPage;     // Where the block begins, 0-based
+    int startLine;
+};
+
+struct ChapterPagination {
+    QString chapterPath;
+    QList<PaginatedBlock> blocks;
+    int pageCount = 0;
+    int lineCount = 0;   // Manuscript lines of text, before page breaks
+};
+
+// Estimates standard-manuscript page counts: 12pt Courier, double-spaced,
+// one-inch margins on US Letter, each chapter opening a third of the way
+// down a new page, with widow and orphan control. Line breaking uses
+// QTextLayout on worker threads. Each pass reuses the previous result up to
+// the first changed block and the line counts of unchanged blocks after it.
+class ManuscriptPaginator : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ManuscriptPaginator(QObject *parent = nullptr);
+    ~ManuscriptPaginator();
+
+    // Pagination; openTexts supplies unsaved editor content by chapter path
+    void paginate(const QStringList& chapterPaths,
+                  const QHash<QString, QString>& openTexts = QHash<QString, QString>());
+    void paginateText(const QString& chapterPath, const QString& text);
+    void clear();
+    bool isPaginating() const { return m_pass.isRunning(); }
+
+    // Results
+    int getPageCount(const QString& chapterPath) const;   // -1 until paginated
+    int getLineCount(const QString& chapterPath) const;   // -1 until paginated
+    int getTotalPages() const;
+
+    // Results of one project, parked while another project is active
+    struct Results;
+    Results takeResults();                  // Leaves the paginator empty
+    void restoreResults(Results results);   // Supersedes any running pass
+
+    // Page model shared with manuscript export, in points
+    static QFont manuscriptFont();
+    static qreal lineHeight();
+    static int linesPerPage();
+
+    // Constants
+    static constexpr qreal PAGE_WIDTH = 612.0;     // US Letter
+    static constexpr qreal PAGE_HEIGHT = 792.0;
+    static constexpr qreal MARGIN = 72.0;
+    static constexpr qreal PARAGRAPH_INDENT = 36.0;
+    static const int CHAPTER_DROP_LINES = 8;       // Chapter openings start a third down
+
+signals:
+    void pageCountsChanged();
+
+private slots:
+    void onPaginationFinished();
+
+private:
+    struct Job {
+        QString chapterPath;
+        QString text;
+        bool hasText;   // Otherwise read from disk on the worker
+        std::shared_ptr<const ChapterPagination> previous;
+    };
+
+    void startQueued();
+    static ChapterPagination paginateJob(const Job& job);
+    static ChapterPagination paginateChapter(const QString& chapterPath, const QString& text,
+                                             const ChapterPagination* previous);
+    static int layoutLines(const QString& block, const QFont& font);
+
+    QStringList m_chapterOrder;
+    QHash<QString, std::shared_ptr<const ChapterPagination>> m_chapters;
+    QHash<QString, QString> m_queuedTexts;      // Editor content waiting for a pass
+    QSet<QString> m_queuedFiles;                // Chapters to read from disk
+    TaskWatcher<ChapterPagination> m_pass;      // Running while a pass runs
+};
+
+struct ManuscriptPaginator::Results {
+    QStringList chapterOrder;
+    QHash<QString, std::shared_ptr<const ChapterPagination>> chapters;
+
+    qint64 estimateMemoryUsage() const;
+};
+
+#endif // MANUSCRIPTPAGINATOR_H
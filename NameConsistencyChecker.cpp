@@ -0,0 +1,326 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "NameConsistencyChecker.h"
+#include "CharacterDatabase.h"
+#include "TaskScheduler.h"
+#include <QFile>
+#include <QTextStream>
+#include <QRegularExpression>
+#include <QDebug>
+#include <utility>
+
+NameConsistencyChecker::NameConsistencyChecker(QObject *parent)
+    : QObject(parent)
+    , m_database(nullptr)
+    , m_check(this)
+    , m_checkQueued(false)
+{
+}
+
+NameConsistencyChecker::~NameConsistencyChecker() = default;
+
+void NameConsistencyChecker::setCharacterDatabase(CharacterDatabase* database)
+{
+    if (m_database) {
+        disconnect(m_database, nullptr, this, nullptr);
+    }
+    
+    m_database = database;
+    
+    if (m_database) {
+        connect(m_database, &CharacterDatabase::charactersChanged,
+                this, &NameConsistencyChecker::onCharactersChanged);
+    }
+    
+    // Rebinding is not a name change; the caller decides whether to recheck
+    m_dictionary = buildDictionary(m_database);
+    m_blockCache.clear();
+}
+
+void NameConsistencyChecker::checkChapters(const QStringList& chapterPaths, const QHash<QString, QString>& openTexts)
+{
+    m_chapterOrder = chapterPaths;
+    m_openTexts = openTexts;
+    
+    // Only one check runs at a time; the newest request runs when it ends
+    if (m_check.isRunning()) {
+        m_checkQueued = true;
+        m_check.cancel();
+        return;
+    }
+    
+    if (!m_dictionary || m_dictionary->tree.isEmpty() || chapterPaths.isEmpty()) {
+        m_issues.clear();
+        emit issuesUpdated();
+        return;
+    }
+    
+    // Workers share the dictionary and a read-only snapshot of the block cache
+    std::shared_ptr<const Dictionary> dictionary = m_dictionary;
+    BlockCache cache = m_blockCache;
+    QHash<QString, QString> texts = m_openTexts;
+    m_openTexts.clear();
+    m_updatedWhileChecking.clear();
+    
+    m_check.start(TaskScheduler::instance()->mapped(TaskScheduler::AnalysisLane, "names", chapterPaths,
+        [dictionary, cache, texts](const QString& chapterPath) {
+            auto openText = texts.constFind(chapterPath);
+            return (openText != texts.constEnd())
+                ? scanText(chapterPath, *openText, *dictionary, cache)
+                : scanFile(chapterPath, *dictionary, cache);
+        }), [this]() { onCheckFinished(); });
+}
+
+void NameConsistencyChecker::checkText(const QString& chapterPath, const QString& text)
+{
+    if (!m_dictionary || !m_chapterOrder.contains(chapterPath)) {
+        return;
+    }
+    
+    // Cached blocks make this cheap enough for the GUI thread after each edit
+    ChapterResult result = scanText(chapterPath, text, *m_dictionary, m_blockCache);
+    mergeBlocks(result.newBlocks);
+    m_issues.insert(chapterPath, result.issues);
+    if (m_check.isRunning()) {
+        m_updatedWhileChecking.insert(chapterPath);
+    }
+    emit issuesUpdated();
+}
+
+void NameConsistencyChecker::clear()
+{
+    m_check.stop();
+    m_checkQueued = false;
+    m_chapterOrder.clear();
+    m_openTexts.clear();
+    m_issues.clear();
+    m_updatedWhileChecking.clear();
+    emit issuesUpdated();
+}
+
+NameConsistencyChecker::Results NameConsistencyChecker::takeResults()
+{
+    m_check.stop();
+    m_checkQueued = false;
+    m_openTexts.clear();
+    m_updatedWhileChecking.clear();
+    
+    Results results;
+    results.chapterOrder = std::exchange(m_chapterOrder, {});
+    results.issues = std::exchange(m_issues, {});
+    results.blockCache = std::exchange(m_blockCache, {});
+    return results;
+}
+
+void NameConsistencyChecker::restoreResults(Results results)
+{
+    m_check.stop();
+    m_checkQueued = false;
+    m_openTexts.clear();
+    m_updatedWhileChecking.clear();
+    
+    m_chapterOrder = std::move(results.chapterOrder);
+    m_issues = std::move(results.issues);
+    m_blockCache = std::move(results.blockCache);
+    emit issuesUpdated();
+}
+
+qint64 NameConsistencyChecker::Results::estimateMemoryUsage() const
+{
+    qint64 bytes = 0;
+    for (const QList<NameIssue>& chapterIssues : issues) {
+        for (const NameIssue& issue : chapterIssues) {
+            bytes += sizeof(NameIssue) + (issue.word.size() + issue.suggestion.size()) * static_cast<qint64>(sizeof(QChar));
+        }
+    }
+    
+    // Most cached blocks have no issues, so the hash node dominates
+    for (const QList<BlockIssue>& blockIssues : blockCache) {
+        bytes += sizeof(size_t) + sizeof(QList<BlockIssue>) + sizeof(void*);
+        bytes += blockIssues.size() * static_cast<qint64>(sizeof(BlockIssue));
+    }
+    
+    return bytes;
+}
+
+QList<NameIssue> NameConsistencyChecker::getIssues() const
+{
+    QList<NameIssue> issues;
+    for (const QString& chapterPath : m_chapterOrder) {
+        issues.append(m_issues.value(chapterPath));
+    }
+    
+    return issues;
+}
+
+void NameConsistencyChecker::onCheckFinished()
+{
+    QFuture<ChapterResult> future = m_check.finish();
+    
+    if (m_checkQueued) {
+        m_checkQueued = false;
+        checkChapters(m_chapterOrder, m_openTexts);
+        return;
+    }
+    
+    QHash<QString, QList<NameIssue>> issues;
+    const QList<ChapterResult> results = future.results();
+    for (const ChapterResult& result : results) {
+        mergeBlocks(result.newBlocks);
+        issues.insert(result.chapterPath, result.issues);
+    }
+    
+    // Chapters rechecked from an editor meanwhile keep their newer results
+    for (const QString& chapterPath : std::as_const(m_updatedWhileChecking)) {
+        issues.insert(chapterPath, m_issues.value(chapterPath));
+    }
+    m_updatedWhileChecking.clear();
+    
+    m_issues = issues;
+    emit issuesUpdated();
+}
+
+void NameConsistencyChecker::onCharactersChanged()
+{
+    m_dictionary = buildDictionary(m_database);
+    
+    // Cached verdicts were made against the old names
+    m_blockCache.clear();
+    emit dictionaryChanged();
+}
+
+std::shared_ptr<const NameConsistencyChecker::Dictionary> NameConsistencyChecker::buildDictionary(const CharacterDatabase* database)
+{
+    auto dictionary = std::make_shared<Dictionary>();
+    if (!database) {
+        return dictionary;
+    }
+    
+    static const QRegularExpression whitespace("\\s+");
+    for (const CharacterRecord& record : database->getCharacters()) {
+        QStringList words = record.name.split(whitespace, Qt::SkipEmptyParts);
+        for (const QString& alias : record.aliases) {
+            words.append(alias.split(whitespace, Qt::SkipEmptyParts));
+        }
+        
+        for (const QString& word : std::as_const(words)) {
+            QString key = word.toLower();
+            dictionary->knownWords.insert(key);
+            if (!dictionary->idByWord.contains(key)) {
+                dictionary->idByWord.insert(key, record.id);
+                dictionary->tree.insert(word);
+            }
+        }
+    }
+    
+    return dictionary;
+}
+
+QList<NameConsistencyChecker::BlockIssue> NameConsistencyChecker::checkBlock(const QString& block, const Dictionary& dictionary)
+{
+    QList<BlockIssue> issues;
+    
+    int i = 0;
+    while (i < block.size()) {
+        if (!block[i].isLetter()) {
+            ++i;
+            continue;
+        }
+        
+        int start = i;
+        while (i < block.size() && block[i].isLetter()) {
+            ++i;
+        }
+        
+        // Only capitalized words can be names; all-caps words are usually emphasis
+        QString word = block.mid(start, i - start);
+        if (word.size() < 5 || !word.front().isUpper() || word == word.toUpper()) {
+            continue;
+        }
+        if (dictionary.knownWords.contains(word.toLower())) {
+            continue;
+        }
+        
+        // One edit for short names, two for longer ones
+        int maxDistance = (word.size() >= 8) ? 2 : 1;
+        const QList<BKTree::Result> matches = dictionary.tree.search(word, maxDistance);
+        if (matches.isEmpty()) {
+            continue;
+        }
+        
+        const BKTree::Result& best = matches.first();
+        issues.append({start, static_cast<int>(word.size()), word, best.word,
+                       dictionary.idByWord.value(best.word.toLower()), best.distance});
+    }
+    
+    return issues;
+}
+
+NameConsistencyChecker::ChapterResult NameConsistencyChecker::scanText(const QString& chapterPath, const QString& text,
+                                                                       const Dictionary& dictionary, const BlockCache& cache)
+{
+    ChapterResult result;
+    result.chapterPath = chapterPath;
+    
+    int blockStart = 0;
+    while (blockStart <= text.size()) {
+        int blockEnd = text.indexOf(QLatin1Char('\n'), blockStart);
+        if (blockEnd < 0) {
+            blockEnd = text.size();
+        }
+        
+        QStringView block = QStringView(text).mid(blockStart, blockEnd - blockStart);
+        size_t hash = qHash(block);
+        
+        QList<BlockIssue> blockIssues;
+        auto cached = cache.constFind(hash);
+        if (cached != cache.constEnd()) {
+            blockIssues = *cached;
+        } else if (result.newBlocks.contains(hash)) {
+            blockIssues = result.newBlocks.value(hash);
+        } else {
+            blockIssues = checkBlock(block.toString(), dictionary);
+            result.newBlocks.insert(hash, blockIssues);
+        }
+        
+        for (const BlockIssue& issue : std::as_const(blockIssues)) {
+            result.issues.append({chapterPath, blockStart + issue.offset, issue.length, issue.word,
+                                  issue.suggestion, issue.characterId, issue.distance});
+        }
+        
+        blockStart = blockEnd + 1;
+    }
+    
+    return result;
+}
+
+NameConsistencyChecker::ChapterResult NameConsistencyChecker::scanFile(const QString& chapterPath, const Dictionary& dictionary,
+                                                                       const BlockCache& cache)
+{
+    QFile file(chapterPath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qDebug() << "Cannot check chapter for name consistency:" << chapterPath;
+        ChapterResult empty;
+        empty.chapterPath = chapterPath;
+        return empty;
+    }
+    
+    QTextStream in(&file);
+    return scanText(chapterPath, in.readAll(), dictionary, cache);
+}
+
+void NameConsistencyChecker::mergeBlocks(const BlockCache& blocks)
+{
+    // Crude bound; clearing is cheap and the next check refills what is used
+    if (m_blockCache.size() + blocks.size() > MAX_CACHED_BLOCKS) {
+        m_blockCache.clear();
+    }
+    
+    for (auto it = blocks.constBegin(); it != blocks.constEnd(); ++it) {
+        m_blockCache.insert(it.key(), it.value());
+    }
+}
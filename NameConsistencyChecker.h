@@ -0,0 +1,123 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef NAMECONSISTENCYCHECKER_H
+#define NAMECONSISTENCYCHECKER_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QSet>
+#include <QList>
+#include <memory>
+#include "BKTree.h"
+#include "TaskWatcher.h"
+
+class CharacterDatabase;
+
+struct NameIssue {
+    QString chapterPath;
+    int position = -1;       // Character offset within the chapter
+    int length = 0;
+    QString word;            // As written
+    QString suggestion;      // Closest character name or alias word
+    QString characterId;
+    int distance = 0;
+};
+
+// Flags capitalized words that are a small edit away from a character name
+// ("Elizbeth"). Chapters are checked in the background; per-paragraph
+// results are cached by content hash, so rechecks only scan edited blocks.
+class NameConsistencyChecker : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit NameConsistencyChecker(QObject *parent = nullptr);
+    ~NameConsistencyChecker();
+
+    void setCharacterDatabase(CharacterDatabase* database);
+
+    // Checking; openTexts supplies unsaved editor content by chapter path
+    void checkChapters(const QStringList& chapterPaths,
+                       const QHash<QString, QString>& openTexts = QHash<QString, QString>());
+    void checkText(const QString& chapterPath, const QString& text);
+    void clear();
+    bool isChecking() const { return m_check.isRunning(); }
+
+    // Results
+    QList<NameIssue> getIssues() const;   // Reading order
+    QList<NameIssue> getIssues(const QString& chapterPath) const { return m_issues.value(chapterPath); }
+
+    // Results of one project, parked while another project is active
+    struct Results;
+    Results takeResults();                  // Leaves the checker empty
+    void restoreResults(Results results);   // Supersedes any running check
+
+    // Constants
+    static const int MAX_CACHED_BLOCKS = 50000;
+
+signals:
+    void issuesUpdated();
+    void dictionaryChanged();   // Character names changed; results need a recheck
+
+private slots:
+    void onCheckFinished();
+    void onCharactersChanged();
+
+private:
+    struct Dictionary {
+        BKTree tree;
+        QSet<QString> knownWords;            // Lower-cased name and alias words
+        QHash<QString, QString> idByWord;    // Lower-cased word -> character ID
+    };
+
+    struct BlockIssue {
+        int offset;      // Within the block
+        int length;
+        QString word;
+        QString suggestion;
+        QString characterId;
+        int distance;
+    };
+
+    using BlockCache = QHash<size_t, QList<BlockIssue>>;   // Block text hash -> issues
+
+    struct ChapterResult {
+        QString chapterPath;
+        QList<NameIssue> issues;
+        BlockCache newBlocks;   // Blocks scanned this time, merged on the GUI thread
+    };
+
+    static std::shared_ptr<const Dictionary> buildDictionary(const CharacterDatabase* database);
+    static QList<BlockIssue> checkBlock(const QString& block, const Dictionary& dictionary);
+    static ChapterResult scanText(const QString& chapterPath, const QString& text,
+                                  const Dictionary& dictionary, const BlockCache& cache);
+    static ChapterResult scanFile(const QString& chapterPath, const Dictionary& dictionary,
+                                  const BlockCache& cache);
+    void mergeBlocks(const BlockCache& blocks);
+
+    CharacterDatabase* m_database;
+    std::shared_ptr<const Dictionary> m_dictionary;
+    BlockCache m_blockCache;
+    QStringList m_chapterOrder;
+    QHash<QString, QString> m_openTexts;            // Editor content for a queued check
+    QHash<QString, QList<NameIssue>> m_issues;      // chapterPath -> issues
+    QSet<QString> m_updatedWhileChecking;           // Fresher than the running check
+    TaskWatcher<ChapterResult> m_check;             // Running while a check runs
+    bool m_checkQueued;
+};
+
+struct NameConsistencyChecker::Results {
+    QStringList chapterOrder;
+    QHash<QString, QList<NameIssue>> issues;
+    BlockCache blockCache;   // Verdicts against this project's names
+
+    qint64 estimateMemoryUsage() const;
+};
+
+#endif // NAMECONSISTENCYCHECKER_H
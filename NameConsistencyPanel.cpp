@@ -0,0 +1,96 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "NameConsistencyPanel.h"
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QFileInfo>
+
+NameConsistencyPanel::NameConsistencyPanel(QWidget *parent)
+    : QWidget(parent)
+    , m_layout(nullptr)
+    , m_summaryLabel(nullptr)
+    , m_recheckButton(nullptr)
+    , m_issueTree(nullptr)
+{
+    setupUI();
+}
+
+NameConsistencyPanel::~NameConsistencyPanel()
+{
+}
+
+void NameConsistencyPanel::setupUI()
+{
+    m_layout = new QVBoxLayout(this);
+    m_layout->setContentsMargins(4, 4, 4, 4);
+    
+    QHBoxLayout* headerLayout = new QHBoxLayout();
+    m_summaryLabel = new QLabel("No name issues", this);
+    m_recheckButton = new QPushButton("Recheck", this);
+    m_recheckButton->setToolTip("Check all chapters against the character list again");
+    headerLayout->addWidget(m_summaryLabel, 1);
+    headerLayout->addWidget(m_recheckButton);
+    m_layout->addLayout(headerLayout);
+    
+    m_issueTree = new QTreeWidget(this);
+    m_issueTree->setHeaderLabels({"Written", "Did you mean"});
+    m_issueTree->setRootIsDecorated(true);
+    m_issueTree->header()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    m_layout->addWidget(m_issueTree);
+    
+    connect(m_recheckButton, &QPushButton::clicked, this, &NameConsistencyPanel::recheckRequested);
+    connect(m_issueTree, &QTreeWidget::itemActivated, this, &NameConsistencyPanel::onItemActivated);
+}
+
+void NameConsistencyPanel::setIssues(const QList<NameIssue>& issues)
+{
+    m_issueTree->clear();
+    
+    // Issues arrive in reading order, so chapters group contiguously
+    QTreeWidgetItem* chapterItem = nullptr;
+    for (const NameIssue& issue : issues) {
+        if (!chapterItem || chapterItem->data(0, PathRole).toString() != issue.chapterPath) {
+            chapterItem = new QTreeWidgetItem(m_issueTree);
+            chapterItem->setText(0, QFileInfo(issue.chapterPath).baseName());
+            chapterItem->setData(0, PathRole, issue.chapterPath);
+            chapterItem->setFirstColumnSpanned(true);
+            chapterItem->setExpanded(true);
+        }
+        
+        QTreeWidgetItem* item = new QTreeWidgetItem(chapterItem);
+        item->setText(0, issue.word);
+        item->setText(1, issue.suggestion);
+        item->setData(0, PathRole, issue.chapterPath);
+        item->setData(0, PositionRole, issue.position);
+        item->setData(0, LengthRole, issue.length);
+    }
+    
+    m_summaryLabel->setText(issues.isEmpty() ? QString("No name issues")
+                                             : QString("%1 possible misspelling(s)").arg(issues.size()));
+}
+
+void NameConsistencyPanel::setChecking(bool checking)
+{
+    m_recheckButton->setEnabled(!checking);
+    if (checking) {
+        m_summaryLabel->setText("Checking names...");
+    }
+}
+
+void NameConsistencyPanel::onItemActivated(QTreeWidgetItem* item, int column)
+{
+    Q_UNUSED(column)
+    
+    // Chapter rows carry no position
+    if (!item || !item->parent()) {
+        return;
+    }
+    
+    emit issueActivated(item->data(0, PathRole).toString(),
+                        item->data(0, PositionRole).toInt(),
+                        item->data(0, LengthRole).toInt());
+}
@@ -0,0 +1,50 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef NAMECONSISTENCYPANEL_H
+#define NAMECONSISTENCYPANEL_H
+
+#include <QWidget>
+#include <QTreeWidget>
+#include <QLabel>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include "NameConsistencyChecker.h"
+
+// Report of suspected character-name misspellings, grouped by chapter
+class NameConsistencyPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit NameConsistencyPanel(QWidget *parent = nullptr);
+    ~NameConsistencyPanel();
+
+    void setIssues(const QList<NameIssue>& issues);
+    void setChecking(bool checking);
+
+signals:
+    void issueActivated(const QString& chapterPath, int position, int length);
+    void recheckRequested();
+
+private slots:
+    void onItemActivated(QTreeWidgetItem* item, int column);
+
+private:
+    void setupUI();
+
+    // Item data roles
+    static const int PathRole = Qt::UserRole;
+    static const int PositionRole = Qt::UserRole + 1;
+    static const int LengthRole = Qt::UserRole + 2;
+
+    QVBoxLayout* m_layout;
+    QLabel* m_summaryLabel;
+    QPushButton* m_recheckButton;
+    QTreeWidget* m_issueTree;
+};
+
+#endif // NAMECONSISTENCYPANEL_H
@@ -57,6 +57,7 @@ QUuid PaneManager::convertTabToPane(QTabWidget* sourceTabWidget, int tabIndex, P
     if (pane->tabWidget) {
         pane->tabWidget->addTab(tabContent, tabText);
         pane->title = tabText;
+        emit tabContentMoved(tabContent, pane->tabWidget);
     }
     
     emit paneCreated(paneId);
@@ -80,6 +81,7 @@ bool PaneManager::convertPaneToTab(const QUuid& paneId, QTabWidget* targetTabWid
         QString tabText = pane->tabWidget->tabText(0);
         pane->tabWidget->removeTab(0);
         targetTabWidget->addTab(tabContent, tabText);
+        emit tabContentMoved(tabContent, targetTabWidget);
     }
     
     // Clean up the pane
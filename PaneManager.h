@@ -68,6 +68,7 @@ signals:
     void paneDestroyed(const QUuid& paneId);
     void paneDetached(const QUuid& paneId);
     void paneAttached(const QUuid& paneId);
+    void tabContentMoved(QWidget* content, QTabWidget* targetTabWidget);
 
 private slots:
     void onTabCloseRequested(int index);
@@ -0,0 +1,257 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "PieceTable.h"
+#include <QIODevice>
+#include <QRandomGenerator>
+#include <QStringEncoder>
+#include <algorithm>
+
+PieceTable::PieceTable()
+    : m_chunkUsed(0)
+{
+}
+
+PieceTable::PieceTable(const QString& text)
+    : m_chunkUsed(0)
+{
+    if (text.isEmpty()) {
+        return;
+    }
+    
+    // The loaded text becomes the original buffer without being copied
+    auto original = std::make_shared<const QString>(text);
+    m_root = makePiece(std::shared_ptr<const QChar>(original, original->constData()), original->size());
+}
+
+PieceTable::PieceTable(const PieceTable& other)
+    : m_root(other.m_root)
+    , m_chunkUsed(0)
+{
+    // The edit buffer is not shared: its free tail is written in place
+}
+
+PieceTable& PieceTable::operator=(const PieceTable& other)
+{
+    if (this != &other) {
+        m_root = other.m_root;
+        m_chunk.reset();
+        m_chunkUsed = 0;
+    }
+    
+    return *this;
+}
+
+qsizetype PieceTable::length() const
+{
+    return m_root ? m_root->total : 0;
+}
+
+int PieceTable::getPieceCount() const
+{
+    return m_root ? m_root->count : 0;
+}
+
+void PieceTable::insert(qsizetype position, QStringView text)
+{
+    if (text.isEmpty()) {
+        return;
+    }
+    position = qBound<qsizetype>(0, position, length());
+    
+    auto [left, right] = split(m_root, position);
+    
+    // Typing appends to the edit buffer right after the previous keystroke,
+    // so the piece before the cursor simply grows instead of adding a node
+    const Node* last = lastNode(left.get());
+    bool contiguous = last && m_chunk && text.size() <= ADD_CHUNK_SIZE - m_chunkUsed &&
+                      last->data.get() + last->length == m_chunk.get() + m_chunkUsed;
+    
+    std::shared_ptr<const QChar> data = appendToBuffer(text);
+    if (contiguous) {
+        left = extendLast(left, text.size());
+    } else {
+        left = merge(left, makePiece(data, text.size()));
+    }
+    
+    m_root = merge(left, right);
+}
+
+void PieceTable::remove(qsizetype position, qsizetype length)
+{
+    position = qBound<qsizetype>(0, position, this->length());
+    length = qBound<qsizetype>(0, length, this->length() - position);
+    if (length == 0) {
+        return;
+    }
+    
+    auto [left, rest] = split(m_root, position);
+    auto [removed, right] = split(rest, length);
+    Q_UNUSED(removed);
+    
+    m_root = merge(left, right);
+}
+
+QString PieceTable::text(qsizetype position, qsizetype length) const
+{
+    position = qBound<qsizetype>(0, position, this->length());
+    length = qBound<qsizetype>(0, length, this->length() - position);
+    
+    QString result;
+    result.reserve(length);
+    visit(m_root.get(), position, position + length, [&result](QStringView piece) {
+        result.append(piece);
+    });
+    
+    return result;
+}
+
+QString PieceTable::toString() const
+{
+    return text(0, length());
+}
+
+void PieceTable::forEachPiece(const std::function<void(QStringView)>& callback) const
+{
+    visit(m_root.get(), 0, length(), callback);
+}
+
+bool PieceTable::writeTo(QIODevice* device) const
+{
+    // One encoder for the whole stream keeps surrogate pairs that straddle
+    // two pieces intact
+    QStringEncoder encoder(QStringEncoder::Utf8);
+    bool ok = true;
+    
+    forEachPiece([&](QStringView piece) {
+        for (qsizetype offset = 0; ok && offset < piece.size(); offset += WRITE_CHUNK_SIZE) {
+            QByteArray bytes = encoder.encode(piece.mid(offset, WRITE_CHUNK_SIZE));
+            ok = device->write(bytes) == bytes.size();
+        }
+    });
+    
+    return ok && !encoder.hasError();
+}
+
+PieceTable::NodePtr PieceTable::makeNode(const std::shared_ptr<const QChar>& data, qsizetype length, quint32 priority,
+                                         const NodePtr& left, const NodePtr& right)
+{
+    auto node = std::make_shared<Node>();
+    node->data = data;
+    node->length = length;
+    node->priority = priority;
+    node->left = left;
+    node->right = right;
+    node->total = length + (left ? left->total : 0) + (right ? right->total : 0);
+    node->count = 1 + (left ? left->count : 0) + (right ? right->count : 0);
+    
+    return node;
+}
+
+PieceTable::NodePtr PieceTable::makePiece(const std::shared_ptr<const QChar>& data, qsizetype length)
+{
+    return makeNode(data, length, QRandomGenerator::global()->generate(), nullptr, nullptr);
+}
+
+std::pair<PieceTable::NodePtr, PieceTable::NodePtr> PieceTable::split(const NodePtr& node, qsizetype position)
+{
+    if (!node) {
+        return {nullptr, nullptr};
+    }
+    
+    qsizetype leftTotal = node->left ? node->left->total : 0;
+    if (position <= leftTotal) {
+        auto [left, right] = split(node->left, position);
+        return {left, makeNode(node->data, node->length, node->priority, right, node->right)};
+    }
+    if (position >= leftTotal + node->length) {
+        auto [left, right] = split(node->right, position - leftTotal - node->length);
+        return {makeNode(node->data, node->length, node->priority, node->left, left), right};
+    }
+    
+    // The cut falls inside this piece: both halves point into the same buffer
+    qsizetype offset = position - leftTotal;
+    std::shared_ptr<const QChar> tail(node->data, node->data.get() + offset);
+    NodePtr head = makeNode(node->data, offset, node->priority, node->left, nullptr);
+    return {head, merge(makePiece(tail, node->length - offset), node->right)};
+}
+
+PieceTable::NodePtr PieceTable::merge(const NodePtr& left, const NodePtr& right)
+{
+    if (!left) {
+        return right;
+    }
+    if (!right) {
+        return left;
+    }
+    
+    if (left->priority > right->priority) {
+        return makeNode(left->data, left->length, left->priority, left->left, merge(left->right, right));
+    }
+    return makeNode(right->data, right->length, right->priority, merge(left, right->left), right->right);
+}
+
+PieceTable::NodePtr PieceTable::extendLast(const NodePtr& node, qsizetype extra)
+{
+    if (!node->right) {
+        return makeNode(node->data, node->length + extra, node->priority, node->left, nullptr);
+    }
+    return makeNode(node->data, node->length, node->priority, node->left, extendLast(node->right, extra));
+}
+
+const PieceTable::Node* PieceTable::lastNode(const Node* node)
+{
+    while (node && node->right) {
+        node = node->right.get();
+    }
+    
+    return node;
+}
+
+void PieceTable::visit(const Node* node, qsizetype from, qsizetype to, const std::function<void(QStringView)>& callback)
+{
+    // In-order walk that skips subtrees outside [from, to)
+    while (node && from < to) {
+        qsizetype leftTotal = node->left ? node->left->total : 0;
+        if (from < leftTotal) {
+            visit(node->left.get(), from, qMin(to, leftTotal), callback);
+        }
+        
+        qsizetype pieceStart = qMax<qsizetype>(from - leftTotal, 0);
+        qsizetype pieceEnd = qMin(to - leftTotal, node->length);
+        if (pieceStart < pieceEnd) {
+            callback(QStringView(node->data.get() + pieceStart, pieceEnd - pieceStart));
+        }
+        
+        // Continue into the right subtree iteratively
+        qsizetype consumed = leftTotal + node->length;
+        from = qMax<qsizetype>(from - consumed, 0);
+        to -= consumed;
+        node = node->right.get();
+    }
+}
+
+std::shared_ptr<const QChar> PieceTable::appendToBuffer(QStringView text)
+{
+    // Oversized inserts (pastes) get a buffer of their own
+    if (text.size() > ADD_CHUNK_SIZE) {
+        std::shared_ptr<QChar[]> buffer(new QChar[text.size()]);
+        std::copy(text.begin(), text.end(), buffer.get());
+        return std::shared_ptr<const QChar>(buffer, buffer.get());
+    }
+    
+    if (!m_chunk || text.size() > ADD_CHUNK_SIZE - m_chunkUsed) {
+        m_chunk.reset(new QChar[ADD_CHUNK_SIZE]);
+        m_chunkUsed = 0;
+    }
+    
+    // Only the unused tail is written, which no piece or snapshot can see yet
+    QChar* start = m_chunk.get() + m_chunkUsed;
+    std::copy(text.begin(), text.end(), start);
+    m_chunkUsed += text.size();
+    
+    return std::shared_ptr<const QChar>(m_chunk, start);
+}
@@ -0,0 +1,77 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef PIECETABLE_H
+#define PIECETABLE_H
+
+#include <QString>
+#include <QStringView>
+#include <functional>
+#include <memory>
+#include <utility>
+
+class QIODevice;
+
+// Text buffer for huge files: pieces of the original text and of an
+// append-only edit buffer, kept in a persistent treap ordered by position.
+// Edits copy only the O(log n) nodes on one path, so copying a table is a
+// constant-time snapshot that stays valid, and readable from other
+// threads, while the original keeps changing.
+class PieceTable
+{
+public:
+    PieceTable();
+    explicit PieceTable(const QString& text);
+    PieceTable(const PieceTable& other);             // Snapshot; shares every piece
+    PieceTable& operator=(const PieceTable& other);
+
+    qsizetype length() const;
+    bool isEmpty() const { return length() == 0; }
+    int getPieceCount() const;
+
+    void insert(qsizetype position, QStringView text);
+    void remove(qsizetype position, qsizetype length);
+
+    QString text(qsizetype position, qsizetype length) const;
+    QString toString() const;   // Copies everything; prefer forEachPiece or writeTo
+    void forEachPiece(const std::function<void(QStringView)>& visit) const;
+    bool writeTo(QIODevice* device) const;   // Streams UTF-8 piece by piece
+
+    // Constants
+    static const int ADD_CHUNK_SIZE = 64 * 1024;     // Characters per edit buffer chunk
+    static const int WRITE_CHUNK_SIZE = 256 * 1024;  // Characters encoded per write
+
+private:
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    struct Node {
+        std::shared_ptr<const QChar> data;   // Start of the piece; keeps its buffer alive
+        qsizetype length;
+        quint32 priority;
+        qsizetype total;                     // Characters in this subtree
+        int count;                           // Pieces in this subtree
+        NodePtr left;
+        NodePtr right;
+    };
+
+    static NodePtr makeNode(const std::shared_ptr<const QChar>& data, qsizetype length, quint32 priority,
+                            const NodePtr& left, const NodePtr& right);
+    static NodePtr makePiece(const std::shared_ptr<const QChar>& data, qsizetype length);
+    static std::pair<NodePtr, NodePtr> split(const NodePtr& node, qsizetype position);
+    static NodePtr merge(const NodePtr& left, const NodePtr& right);
+    static NodePtr extendLast(const NodePtr& node, qsizetype extra);
+    static const Node* lastNode(const Node* node);
+    static void visit(const Node* node, qsizetype from, qsizetype to, const std::function<void(QStringView)>& callback);
+
+    std::shared_ptr<const QChar> appendToBuffer(QStringView text);
+
+    NodePtr m_root;
+    std::shared_ptr<QChar[]> m_chunk;   // Current edit buffer; owned by this table alone
+    qsizetype m_chunkUsed;
+};
+
+#endif // PIECETABLE_H
@@ -5,18 +5,31 @@
  */
 
 #include "ProjectManager.h"
+#include "AtomicFileWriter.h"
+#include "CharacterDatabase.h"
 #include <QFileInfo>
 #include <QJsonArray>
 #include <QDebug>
 #include <QStandardPaths>
+#include <QUuid>
 
 ProjectManager::ProjectManager(QObject *parent)
     : QObject(parent)
+    , m_fileWriter(new AtomicFileWriter(this))
+    , m_characters(new CharacterDatabase(m_fileWriter, this))
     , m_projectModified(false)
+    , m_jsonExportPending(false)
+    , m_snapshot(std::make_shared<const ProjectSnapshot>())
+    , m_snapshotGeneration(0)
 {
+    connect(m_fileWriter, &AtomicFileWriter::writeFailed, this, &ProjectManager::saveFailed);
+    connect(m_characters, &CharacterDatabase::charactersChanged, this, &ProjectManager::publishSnapshot);
 }
 
-ProjectManager::~ProjectManager() = default;
+ProjectManager::~ProjectManager()
+{
+    m_fileWriter->waitForFinished();
+}
 
 bool ProjectManager::createProject(const QString& projectPath, const QString& projectName)
 {
@@ -51,7 +64,11 @@ bool ProjectManager::createProject(const QString& projectPath, const QString& pr
         m_hashtagsPath = QDir(projectPath).filePath(".hashtags");
         
         initializeHashtagIndex();
+        m_chapterOrder.clear();
+        syncChapterManifest();
+        m_characters->load(m_charactersPath);
         
+        publishSnapshot();
         emit projectOpened(projectName);
         return true;
         
@@ -73,7 +90,7 @@ bool ProjectManager::openProject(const QString& projectFilePath)
     }
     
     m_currentProjectPath = QFileInfo(projectFilePath).absolutePath();
-    m_currentProjectName = m_projectMetadata["name"].toString();
+    m_currentProjectName = m_metadata.getName();
     
     // Initialize paths
     m_chaptersPath = QDir(m_currentProjectPath).filePath("chapters");
@@ -96,6 +113,13 @@ bool ProjectManager::openProject(const QString& projectFilePath)
         }
     }
     
+    // Load chapter order and pick up files added outside the app
+    loadChapterManifest();
+    syncChapterManifest();
+    
+    m_characters->load(m_charactersPath);
+    
+    publishSnapshot();
     emit projectOpened(m_currentProjectName);
     return true;
 }
@@ -106,12 +130,15 @@ bool ProjectManager::saveProject()
         return false;
     }
     
-    bool success = saveProjectMetadata();
+    // An explicit save also refreshes project.json for compatibility
+    bool success = saveProjectMetadata() && exportProjectJson();
     if (success) {
         saveHashtagIndex();
         m_projectModified = false;
     }
     
+    // Explicit saves skip the debounce
+    m_fileWriter->flush();
     return success;
 }
 
@@ -119,14 +146,20 @@ bool ProjectManager::closeProject()
 {
     if (m_projectModified) {
         saveProject();
+    } else if (m_jsonExportPending) {
+        exportProjectJson();
     }
+    m_fileWriter->waitForFinished();
     
     m_currentProjectPath.clear();
     m_currentProjectName.clear();
-    m_projectMetadata = QJsonObject();
+    m_metadata.clear();
     m_globalHashtags.clear();
+    m_chapterOrder.clear();
+    m_characters->clear();
     m_projectModified = false;
     
+    publishSnapshot();
     emit projectClosed();
     return true;
 }
@@ -148,59 +181,217 @@ bool ProjectManager::projectExists(const QString& projectPath) const
 QStringList ProjectManager::getChapterList() const
 {
     QStringList chapters;
-    QDir chaptersDir(m_chaptersPath);
-    
-    if (chaptersDir.exists()) {
-        QStringList filters;
-        filters << "*.md" << "*.txt";
-        QFileInfoList files = chaptersDir.entryInfoList(filters, QDir::Files, QDir::Name);
-        
-        for (const QFileInfo& file : files) {
-            chapters.append(file.baseName());
-        }
+    for (const ChapterEntry& entry : m_chapterOrder) {
+        chapters.append(QFileInfo(entry.fileName).baseName());
     }
     
     return chapters;
 }
 
+QStringList ProjectManager::getChapterFiles() const
+{
+    QStringList files;
+    for (const ChapterEntry& entry : m_chapterOrder) {
+        files.append(entry.fileName);
+    }
+    
+    return files;
+}
+
 QStringList ProjectManager::getCharacterList() const
 {
-    QStringList characters;
-    // TODO: Implement character list extraction from characters.json
-    return characters;
+    return m_characters->getCharacterNames();
+}
+
+QString ProjectManager::getChapterId(const QString& chapterFile) const
+{
+    int index = indexOfChapterFile(chapterFile);
+    return (index >= 0) ? m_chapterOrder[index].id : QString();
+}
+
+QString ProjectManager::getChapterFile(const QString& chapterId) const
+{
+    for (const ChapterEntry& entry : m_chapterOrder) {
+        if (entry.id == chapterId) {
+            return entry.fileName;
+        }
+    }
+    
+    return QString();
+}
+
+int ProjectManager::getChapterNumber(const QString& chapterFile) const
+{
+    // Display numbers are derived from the manifest position, never stored
+    int index = indexOfChapterFile(chapterFile);
+    return (index >= 0) ? index + 1 : 0;
+}
+
+QString ProjectManager::addChapterToOrder(const QString& chapterFile)
+{
+    QString fileName = QFileInfo(chapterFile).fileName();
+    int index = indexOfChapterFile(fileName);
+    if (index >= 0) {
+        return m_chapterOrder[index].id;
+    }
+    
+    ChapterEntry entry;
+    entry.id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+    entry.fileName = fileName;
+    m_chapterOrder.append(entry);
+    
+    storeChapterManifest();
+    saveProjectMetadata();
+    publishSnapshot();
+    
+    emit chapterAdded(QFileInfo(fileName).baseName());
+    emit chapterOrderChanged();
+    return entry.id;
+}
+
+bool ProjectManager::renameChapterInOrder(const QString& oldFile, const QString& newFile)
+{
+    int index = indexOfChapterFile(QFileInfo(oldFile).fileName());
+    if (index < 0) {
+        return false;
+    }
+    
+    // The ID stays the same, so targets and references keyed by it survive
+    m_chapterOrder[index].fileName = QFileInfo(newFile).fileName();
+    
+    storeChapterManifest();
+    bool success = saveProjectMetadata();
+    publishSnapshot();
+    return success;
+}
+
+bool ProjectManager::removeChapterFromOrder(const QString& chapterFile)
+{
+    QString fileName = QFileInfo(chapterFile).fileName();
+    int index = indexOfChapterFile(fileName);
+    if (index < 0) {
+        return false;
+    }
+    
+    m_chapterOrder.removeAt(index);
+    
+    storeChapterManifest();
+    bool success = saveProjectMetadata();
+    publishSnapshot();
+    
+    emit chapterRemoved(QFileInfo(fileName).baseName());
+    emit chapterOrderChanged();
+    return success;
+}
+
+bool ProjectManager::moveChapterInOrder(int fromIndex, int toIndex)
+{
+    if (fromIndex < 0 || fromIndex >= m_chapterOrder.size() ||
+        toIndex < 0 || toIndex >= m_chapterOrder.size()) {
+        return false;
+    }
+    
+    if (fromIndex == toIndex) {
+        return true;
+    }
+    
+    // A reorder is a single metadata write; chapter files are left untouched
+    m_chapterOrder.move(fromIndex, toIndex);
+    
+    storeChapterManifest();
+    bool success = saveProjectMetadata();
+    publishSnapshot();
+    
+    emit chapterOrderChanged();
+    return success;
+}
+
+void ProjectManager::syncChapterManifest()
+{
+    QDir chaptersDir(m_chaptersPath);
+    if (!chaptersDir.exists()) {
+        return;
+    }
+    
+    QStringList filters;
+    filters << "*.md" << "*.txt";
+    QStringList files = chaptersDir.entryList(filters, QDir::Files, QDir::Name);
+    
+    bool changed = !m_metadata.hasChapterOrder();
+    
+    // Drop entries whose files disappeared
+    for (int i = m_chapterOrder.size() - 1; i >= 0; --i) {
+        if (!files.contains(m_chapterOrder[i].fileName)) {
+            m_chapterOrder.removeAt(i);
+            changed = true;
+        }
+    }
+    
+    // Append files the manifest does not know about yet, in name order
+    for (const QString& file : files) {
+        if (indexOfChapterFile(file) < 0) {
+            ChapterEntry entry;
+            entry.id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+            entry.fileName = file;
+            m_chapterOrder.append(entry);
+            changed = true;
+        }
+    }
+    
+    if (changed) {
+        storeChapterManifest();
+        saveProjectMetadata();
+        publishSnapshot();
+        emit chapterOrderChanged();
+    }
 }
 
 void ProjectManager::setChapterWordTarget(const QString& chapter, int target)
 {
-    QJsonObject targets = m_projectMetadata["wordTargets"].toObject();
-    QJsonObject chapterTargets = targets["chapters"].toObject();
-    chapterTargets[chapter] = target;
-    targets["chapters"] = chapterTargets;
-    m_projectMetadata["wordTargets"] = targets;
+    m_metadata.setChapterWordTarget(chapter, target);
     m_projectModified = true;
+    saveProjectMetadata();
+    publishSnapshot();
     emit projectModified();
 }
 
 int ProjectManager::getChapterWordTarget(const QString& chapter) const
 {
-    QJsonObject targets = m_projectMetadata["wordTargets"].toObject();
-    QJsonObject chapterTargets = targets["chapters"].toObject();
-    return chapterTargets[chapter].toInt();
+    return m_metadata.getChapterWordTarget(chapter);
 }
 
 void ProjectManager::setProjectWordTarget(int target)
 {
-    QJsonObject targets = m_projectMetadata["wordTargets"].toObject();
-    targets["project"] = target;
-    m_projectMetadata["wordTargets"] = targets;
+    m_metadata.setProjectWordTarget(target);
     m_projectModified = true;
+    saveProjectMetadata();
+    publishSnapshot();
     emit projectModified();
 }
 
 int ProjectManager::getProjectWordTarget() const
 {
-    QJsonObject targets = m_projectMetadata["wordTargets"].toObject();
-    return targets["project"].toInt();
+    return m_metadata.getProjectWordTarget();
+}
+
+void ProjectManager::setComputedHeadingNumbering(bool computed)
+{
+    if (isComputedHeadingNumbering() == computed) {
+        return;
+    }
+    
+    m_metadata.setComputedHeadingNumbering(computed);
+    m_projectModified = true;
+    saveProjectMetadata();
+    publishSnapshot();
+    emit projectModified();
+    emit headingNumberingChanged(computed);
+}
+
+bool ProjectManager::isComputedHeadingNumbering() const
+{
+    // Projects created before this setting existed keep stored numbering
+    return m_metadata.isComputedHeadingNumbering();
 }
 
 QStringList ProjectManager::getAllHashtags() const
@@ -214,6 +405,8 @@ void ProjectManager::addHashtag(const QString& hashtag)
         m_globalHashtags.append(hashtag);
         m_globalHashtags.sort();
         m_projectModified = true;
+        saveHashtagIndex();
+        publishSnapshot();
         emit projectModified();
     }
 }
@@ -222,10 +415,37 @@ void ProjectManager::removeHashtag(const QString& hashtag)
 {
     if (m_globalHashtags.removeAll(hashtag) > 0) {
         m_projectModified = true;
+        saveHashtagIndex();
+        publishSnapshot();
         emit projectModified();
     }
 }
 
+qint64 ProjectManager::estimateMemoryUsage() const
+{
+    // The snapshot shares its manifest and hashtags with this manager
+    qint64 bytes = m_characters->estimateMemoryUsage() + getSnapshot()->estimateMemoryUsage();
+    if (m_parkedCache) {
+        bytes += m_parkedCache->estimateMemoryUsage();
+    }
+    
+    return bytes;
+}
+
+void ProjectManager::releaseCaches()
+{
+    // Only derived data goes; everything persisted stays loaded
+    m_characters->releaseMatcher();
+    m_parkedCache.reset();
+}
+
+void ProjectManager::restoreCaches()
+{
+    if (!m_currentProjectPath.isEmpty()) {
+        m_characters->ensureMatcher();
+    }
+}
+
 void ProjectManager::createProjectStructure(const QString& projectPath)
 {
     QDir dir(projectPath);
@@ -248,52 +468,48 @@ void ProjectManager::createProjectStructure(const QString& projectPath)
 
 void ProjectManager::createDefaultProjectFile(const QString& projectPath, const QString& projectName)
 {
-    QJsonObject project;
-    project["name"] = projectName;
-    project["version"] = "1.0";
-    project["created"] = QDateTime::currentDateTime().toString(Qt::ISODate);
-    project["modified"] = QDateTime::currentDateTime().toString(Qt::ISODate);
-    project["author"] = "";
-    project["description"] = "";
-    
-    // Word count targets
-    QJsonObject wordTargets;
-    wordTargets["project"] = 80000;  // Default novel target
-    wordTargets["chapters"] = QJsonObject();
-    project["wordTargets"] = wordTargets;
+    m_metadata.clear();
+    m_metadata.setName(projectName);
+    m_metadata.touchModified();
+    m_metadata.setProjectWordTarget(80000);  // Default novel target
+    m_metadata.setAutoSaveEnabled(true);
+    m_metadata.setBackupCount(5);
+    m_metadata.setComputedHeadingNumbering(true);
     
-    // Settings
-    QJsonObject settings;
-    settings["autoSave"] = true;
-    settings["backupCount"] = 5;
-    project["settings"] = settings;
-    
-    m_projectMetadata = project;
-    
-    QJsonDocument doc(project);
-    QFile file(QDir(projectPath).filePath("project.json"));
-    if (file.open(QIODevice::WriteOnly)) {
-        file.write(doc.toJson());
-    }
+    // New projects get both the binary store and the JSON file the open dialog expects
+    QDir dir(projectPath);
+    m_metadata.saveToFile(dir.filePath("project.cbor"));
+    m_metadata.saveToFile(dir.filePath("project.json"));
+    m_metadata.clearDirty();
+    m_jsonExportPending = false;
 }
 
 bool ProjectManager::loadProjectMetadata(const QString& projectFilePath)
 {
-    QFile file(projectFilePath);
-    if (!file.open(QIODevice::ReadOnly)) {
-        qDebug() << "Cannot open project file:" << projectFilePath;
-        return false;
-    }
+    // Both files carry the generation they were written at. File times are no
+    // guide: copies, checkouts and sync tools all rewrite them. The binary store
+    // wins ties, so a hand edit to project.json must raise its "generation".
+    const QString cborPath = QFileInfo(projectFilePath).dir().filePath("project.cbor");
+    
+    ProjectMetadata json;
+    const bool jsonLoaded = json.loadFromFile(projectFilePath);
     
-    QByteArray data = file.readAll();
-    QJsonDocument doc = QJsonDocument::fromJson(data);
+    ProjectMetadata cbor;
+    if (QFileInfo::exists(cborPath) && cbor.loadFromFile(cborPath) &&
+        (!jsonLoaded || cbor.getGeneration() >= json.getGeneration())) {
+        m_metadata = cbor;
+        m_jsonExportPending = cbor.getGeneration() > json.getGeneration();
+        return true;
+    }
     
-    if (doc.isNull() || !doc.isObject()) {
-        qDebug() << "Invalid project file format:" << projectFilePath;
+    if (!jsonLoaded) {
         return false;
     }
     
-    m_projectMetadata = doc.object();
+    // Migrate: the next metadata save writes project.cbor
+    m_metadata = json;
+    m_metadata.markDirty(ProjectMetadata::AllFields);
+    m_jsonExportPending = false;
     return true;
 }
 
@@ -303,21 +519,98 @@ bool ProjectManager::saveProjectMetadata()
         return false;
     }
     
+    // Nothing changed since the last write
+    if (!m_metadata.isDirty()) {
+        return true;
+    }
+    
     // Update modification time
-    m_projectMetadata["modified"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+    m_metadata.touchModified();
     
-    QJsonDocument doc(m_projectMetadata);
-    QFile file(QDir(m_currentProjectPath).filePath("project.json"));
+    // Bursts of changes collapse into a single write of the latest snapshot
+    m_fileWriter->scheduleWrite(QDir(m_currentProjectPath).filePath("project.cbor"), m_metadata.toCborData());
     
-    if (!file.open(QIODevice::WriteOnly)) {
-        qDebug() << "Cannot save project file";
+    m_metadata.clearDirty();
+    m_jsonExportPending = true;
+    return true;
+}
+
+bool ProjectManager::exportProjectJson()
+{
+    if (m_currentProjectPath.isEmpty()) {
         return false;
     }
     
-    file.write(doc.toJson());
+    if (!m_jsonExportPending) {
+        return true;
+    }
+    
+    // Unsaved changes go to project.cbor first so both files share a generation
+    if (m_metadata.isDirty()) {
+        saveProjectMetadata();
+    }
+    
+    m_fileWriter->scheduleWrite(QDir(m_currentProjectPath).filePath("project.json"), m_metadata.toJsonData());
+    m_jsonExportPending = false;
     return true;
 }
 
+void ProjectManager::loadChapterManifest()
+{
+    m_chapterOrder.clear();
+    
+    for (ChapterEntry entry : m_metadata.getChapterOrder()) {
+        if (entry.fileName.isEmpty() || indexOfChapterFile(entry.fileName) >= 0) {
+            continue;
+        }
+        if (entry.id.isEmpty()) {
+            entry.id = QUuid::createUuid().toString(QUuid::WithoutBraces);
+        }
+        m_chapterOrder.append(entry);
+    }
+}
+
+void ProjectManager::storeChapterManifest()
+{
+    m_metadata.setChapterOrder(m_chapterOrder);
+}
+
+void ProjectManager::publishSnapshot()
+{
+    // Built in full on the GUI thread, then swapped in; nothing mutates it afterwards
+    auto snapshot = std::make_shared<ProjectSnapshot>();
+    snapshot->m_generation = ++m_snapshotGeneration;
+    if (!m_currentProjectPath.isEmpty()) {
+        snapshot->m_projectPath = m_currentProjectPath;
+        snapshot->m_projectName = m_currentProjectName;
+        snapshot->m_title = m_metadata.getName().isEmpty() ? m_currentProjectName : m_metadata.getName();
+        snapshot->m_author = m_metadata.getAuthor();
+        snapshot->m_chapterOrder = m_chapterOrder;
+        snapshot->m_projectWordTarget = m_metadata.getProjectWordTarget();
+        snapshot->m_chapterWordTargets = m_metadata.getChapterWordTargets();
+        snapshot->m_computedHeadingNumbering = m_metadata.isComputedHeadingNumbering();
+        snapshot->m_hashtags = m_globalHashtags;
+        snapshot->m_characters = m_characters->getCharacters();
+    }
+    
+    m_snapshot.store(std::move(snapshot), std::memory_order_release);
+    
+    // Whatever was parked was derived from the previous state
+    m_parkedCache.reset();
+    emit snapshotPublished(m_snapshotGeneration);
+}
+
+int ProjectManager::indexOfChapterFile(const QString& chapterFile) const
+{
+    for (int i = 0; i < m_chapterOrder.size(); ++i) {
+        if (m_chapterOrder[i].fileName == chapterFile) {
+            return i;
+        }
+    }
+    
+    return -1;
+}
+
 void ProjectManager::initializeHashtagIndex()
 {
     m_globalHashtags.clear();
@@ -335,9 +628,5 @@ void ProjectManager::saveHashtagIndex()
     
     QJsonDocument doc(array);
     QDir hashtagDir(m_hashtagsPath);
-    QFile file(hashtagDir.filePath("index.json"));
-    
-    if (file.open(QIODevice::WriteOnly)) {
-        file.write(doc.toJson());
-    }
+    m_fileWriter->scheduleWrite(hashtagDir.filePath("index.json"), doc.toJson());
 }
\ No newline at end of file
@@ -14,6 +14,22 @@
 #include <QJsonDocument>
 #include <QDateTime>
 #include <QStringList>
+#include <QList>
+#include <atomic>
+#include <memory>
+#include "ProjectMetadata.h"
+#include "ProjectSnapshot.h"
+
+class AtomicFileWriter;
+class CharacterDatabase;
+
+// Derived data the window parks with a project while another one is active
+class ProjectCache
+{
+public:
+    virtual ~ProjectCache() = default;
+    virtual qint64 estimateMemoryUsage() const = 0;
+};
 
 class ProjectManager : public QObject
 {
@@ -36,11 +52,28 @@ public:
     // Project information
     QString getCurrentProjectPath() const { return m_currentProjectPath; }
     QString getCurrentProjectName() const { return m_currentProjectName; }
-    QJsonObject getProjectMetadata() const { return m_projectMetadata; }
+    const ProjectMetadata& getMetadata() const { return m_metadata; }
+    QJsonObject getProjectMetadata() const { return m_metadata.toJsonObject(); }
     
     // Project structure
-    QStringList getChapterList() const;
+    QStringList getChapterList() const;   // Base names, in manifest order
+    QStringList getChapterFiles() const;  // File names, in manifest order
     QStringList getCharacterList() const;
+    CharacterDatabase* getCharacterDatabase() const { return m_characters; }
+    AtomicFileWriter* getFileWriter() const { return m_fileWriter; }
+    
+    // Consistent read-only view for any thread; never null
+    std::shared_ptr<const ProjectSnapshot> getSnapshot() const { return m_snapshot.load(std::memory_order_acquire); }
+    
+    // Chapter ordering manifest (stable IDs, order stored in project.json)
+    QString getChapterId(const QString& chapterFile) const;
+    QString getChapterFile(const QString& chapterId) const;
+    int getChapterNumber(const QString& chapterFile) const;  // 1-based display number
+    QString addChapterToOrder(const QString& chapterFile);
+    bool renameChapterInOrder(const QString& oldFile, const QString& newFile);
+    bool removeChapterFromOrder(const QString& chapterFile);
+    bool moveChapterInOrder(int fromIndex, int toIndex);
+    void syncChapterManifest();
     
     // Word count targets
     void setChapterWordTarget(const QString& chapter, int target);
@@ -48,10 +81,23 @@ public:
     void setProjectWordTarget(int target);
     int getProjectWordTarget() const;
     
+    // Heading numbering mode: computed numbers are never written into files
+    void setComputedHeadingNumbering(bool computed);
+    bool isComputedHeadingNumbering() const;
+    
     // Global hashtags
     QStringList getAllHashtags() const;
     void addHashtag(const QString& hashtag);
     void removeHashtag(const QString& hashtag);
+    
+    // Memory budgeting for background projects in the workspace
+    qint64 estimateMemoryUsage() const;
+    void releaseCaches();
+    void restoreCaches();
+    
+    // Parked derived data; dropped on any change to the project or when released
+    void parkCache(std::unique_ptr<ProjectCache> cache) { m_parkedCache = std::move(cache); }
+    std::unique_ptr<ProjectCache> takeParkedCache() { return std::move(m_parkedCache); }
 
 signals:
     void projectOpened(const QString& projectName);
@@ -59,20 +105,40 @@ signals:
     void projectModified();
     void chapterAdded(const QString& chapterName);
     void chapterRemoved(const QString& chapterName);
+    void chapterOrderChanged();
+    void headingNumberingChanged(bool computed);
+    void saveFailed(const QString& filePath, const QString& error);
+    void snapshotPublished(quint64 generation);
 
 private:
     void createProjectStructure(const QString& projectPath);
     void createDefaultProjectFile(const QString& projectPath, const QString& projectName);
     bool loadProjectMetadata(const QString& projectFilePath);
     bool saveProjectMetadata();
+    bool exportProjectJson();
     void initializeHashtagIndex();
     void saveHashtagIndex();
+    void loadChapterManifest();
+    void storeChapterManifest();
+    int indexOfChapterFile(const QString& chapterFile) const;
+    void publishSnapshot();
+    
+    using ChapterEntry = ChapterManifestEntry;
     
     QString m_currentProjectPath;
     QString m_currentProjectName;
-    QJsonObject m_projectMetadata;
+    ProjectMetadata m_metadata;
+    AtomicFileWriter* m_fileWriter;  // Debounced, crash-safe background writes
+    CharacterDatabase* m_characters;
     QStringList m_globalHashtags;
+    QList<ChapterEntry> m_chapterOrder;
     bool m_projectModified;
+    bool m_jsonExportPending;  // project.cbor is newer than project.json
+    
+    // Replaced whole on every change; readers keep whichever one they loaded
+    std::atomic<std::shared_ptr<const ProjectSnapshot>> m_snapshot;
+    quint64 m_snapshotGeneration;
+    std::unique_ptr<ProjectCache> m_parkedCache;
     
     // Project structure paths
     QString m_chaptersPath;
@@ -0,0 +1,317 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "ProjectMetadata.h"
+#include <QCborArray>
+#include <QCborValue>
+#include <QJsonDocument>
+#include <QFile>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QDebug>
+
+namespace {
+
+// JSON numbers may arrive as doubles, CBOR numbers as integers
+int cborToInt(const QCborValue& value, int defaultValue)
+{
+    if (value.isInteger()) {
+        return static_cast<int>(value.toInteger());
+    }
+    if (value.isDouble()) {
+        return qRound(value.toDouble());
+    }
+    return defaultValue;
+}
+
+}
+
+ProjectMetadata::ProjectMetadata()
+{
+    clear();
+}
+
+void ProjectMetadata::clear()
+{
+    m_name.clear();
+    m_version = "1.0";
+    m_created.clear();
+    m_modified.clear();
+    m_generation = 0;
+    m_author.clear();
+    m_description.clear();
+    
+    m_projectWordTarget = 0;
+    m_chapterWordTargets.clear();
+    
+    m_autoSave = true;
+    m_backupCount = 5;
+    m_computedHeadingNumbering = false;  // Older projects keep stored numbering
+    
+    m_chapterOrder.clear();
+    m_hasChapterOrder = false;
+    
+    m_extraFields = QCborMap();
+    m_extraSettings = QCborMap();
+    
+    m_dirtyFields = NoFields;
+}
+
+void ProjectMetadata::setName(const QString& name)
+{
+    if (m_name != name) {
+        m_name = name;
+        markDirty(InfoField);
+    }
+}
+
+void ProjectMetadata::setAuthor(const QString& author)
+{
+    if (m_author != author) {
+        m_author = author;
+        markDirty(InfoField);
+    }
+}
+
+void ProjectMetadata::setDescription(const QString& description)
+{
+    if (m_description != description) {
+        m_description = description;
+        markDirty(InfoField);
+    }
+}
+
+void ProjectMetadata::touchModified()
+{
+    m_modified = QDateTime::currentDateTime().toString(Qt::ISODate);
+    ++m_generation;
+    if (m_created.isEmpty()) {
+        m_created = m_modified;
+    }
+    markDirty(InfoField);
+}
+
+void ProjectMetadata::setProjectWordTarget(int target)
+{
+    if (m_projectWordTarget != target) {
+        m_projectWordTarget = target;
+        markDirty(WordTargetsField);
+    }
+}
+
+void ProjectMetadata::setChapterWordTarget(const QString& chapter, int target)
+{
+    auto it = m_chapterWordTargets.find(chapter);
+    if (it != m_chapterWordTargets.end() && it.value() == target) {
+        return;
+    }
+    
+    m_chapterWordTargets.insert(chapter, target);
+    markDirty(WordTargetsField);
+}
+
+void ProjectMetadata::setAutoSaveEnabled(bool enabled)
+{
+    if (m_autoSave != enabled) {
+        m_autoSave = enabled;
+        markDirty(SettingsField);
+    }
+}
+
+void ProjectMetadata::setBackupCount(int count)
+{
+    if (m_backupCount != count) {
+        m_backupCount = count;
+        markDirty(SettingsField);
+    }
+}
+
+void ProjectMetadata::setComputedHeadingNumbering(bool computed)
+{
+    if (m_computedHeadingNumbering != computed) {
+        m_computedHeadingNumbering = computed;
+        markDirty(SettingsField);
+    }
+}
+
+void ProjectMetadata::setChapterOrder(const QList<ChapterManifestEntry>& order)
+{
+    m_chapterOrder = order;
+    m_hasChapterOrder = true;
+    markDirty(ChapterOrderField);
+}
+
+QCborMap ProjectMetadata::toCbor() const
+{
+    QCborMap map = m_extraFields;
+    
+    map[QLatin1String("name")] = m_name;
+    map[QLatin1String("version")] = m_version;
+    map[QLatin1String("created")] = m_created;
+    map[QLatin1String("modified")] = m_modified;
+    map[QLatin1String("generation")] = m_generation;
+    map[QLatin1String("author")] = m_author;
+    map[QLatin1String("description")] = m_description;
+    
+    QCborMap chapterTargets;
+    for (auto it = m_chapterWordTargets.constBegin(); it != m_chapterWordTargets.constEnd(); ++it) {
+        chapterTargets[it.key()] = it.value();
+    }
+    QCborMap wordTargets;
+    wordTargets[QLatin1String("project")] = m_projectWordTarget;
+    wordTargets[QLatin1String("chapters")] = chapterTargets;
+    map[QLatin1String("wordTargets")] = wordTargets;
+    
+    QCborMap settings = m_extraSettings;
+    settings[QLatin1String("autoSave")] = m_autoSave;
+    settings[QLatin1String("backupCount")] = m_backupCount;
+    settings[QLatin1String("headingNumbering")] = m_computedHeadingNumbering ? QStringLiteral("computed") : QStringLiteral("stored");
+    map[QLatin1String("settings")] = settings;
+    
+    if (m_hasChapterOrder) {
+        QCborArray order;
+        for (const ChapterManifestEntry& entry : m_chapterOrder) {
+            QCborMap object;
+            object[QLatin1String("id")] = entry.id;
+            object[QLatin1String("file")] = entry.fileName;
+            order.append(object);
+        }
+        map[QLatin1String("chapterOrder")] = order;
+    }
+    
+    return map;
+}
+
+QJsonObject ProjectMetadata::toJsonObject() const
+{
+    return toCbor().toJsonObject();
+}
+
+ProjectMetadata ProjectMetadata::fromCbor(const QCborMap& map)
+{
+    ProjectMetadata metadata;
+    
+    for (auto it = map.constBegin(); it != map.constEnd(); ++it) {
+        const QString key = it.key().toString();
+        const QCborValue value = it.value();
+        
+        if (key == "name") {
+            metadata.m_name = value.toString();
+        } else if (key == "version") {
+            metadata.m_version = value.toString();
+        } else if (key == "created") {
+            metadata.m_created = value.toString();
+        } else if (key == "modified") {
+            metadata.m_modified = value.toString();
+        } else if (key == "generation") {
+            metadata.m_generation = value.isInteger() ? value.toInteger() : qRound64(value.toDouble());
+        } else if (key == "author") {
+            metadata.m_author = value.toString();
+        } else if (key == "description") {
+            metadata.m_description = value.toString();
+        } else if (key == "wordTargets") {
+            QCborMap wordTargets = value.toMap();
+            metadata.m_projectWordTarget = cborToInt(wordTargets.value(QLatin1String("project")), 0);
+            
+            QCborMap chapterTargets = wordTargets.value(QLatin1String("chapters")).toMap();
+            metadata.m_chapterWordTargets.reserve(chapterTargets.size());
+            for (auto target = chapterTargets.constBegin(); target != chapterTargets.constEnd(); ++target) {
+                metadata.m_chapterWordTargets.insert(target.key().toString(), cborToInt(target.value(), 0));
+            }
+        } else if (key == "settings") {
+            QCborMap settings = value.toMap();
+            metadata.m_autoSave = settings.value(QLatin1String("autoSave")).toBool(true);
+            metadata.m_backupCount = cborToInt(settings.value(QLatin1String("backupCount")), 5);
+            metadata.m_computedHeadingNumbering =
+                settings.value(QLatin1String("headingNumbering")).toString() == "computed";
+            
+            settings.remove(QLatin1String("autoSave"));
+            settings.remove(QLatin1String("backupCount"));
+            settings.remove(QLatin1String("headingNumbering"));
+            metadata.m_extraSettings = settings;
+        } else if (key == "chapterOrder") {
+            const QCborArray order = value.toArray();
+            metadata.m_chapterOrder.reserve(order.size());
+            for (const QCborValue& item : order) {
+                QCborMap object = item.toMap();
+                ChapterManifestEntry entry;
+                entry.id = object.value(QLatin1String("id")).toString();
+                entry.fileName = object.value(QLatin1String("file")).toString();
+                metadata.m_chapterOrder.append(entry);
+            }
+            metadata.m_hasChapterOrder = true;
+        } else {
+            metadata.m_extraFields.insert(it.key(), value);
+        }
+    }
+    
+    metadata.m_dirtyFields = NoFields;
+    return metadata;
+}
+
+ProjectMetadata ProjectMetadata::fromJsonObject(const QJsonObject& object)
+{
+    return fromCbor(QCborMap::fromJsonObject(object));
+}
+
+QByteArray ProjectMetadata::toCborData() const
+{
+    return toCbor().toCborValue().toCbor();
+}
+
+QByteArray ProjectMetadata::toJsonData() const
+{
+    return QJsonDocument(toJsonObject()).toJson();
+}
+
+bool ProjectMetadata::loadFromFile(const QString& filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "Cannot open project file:" << filePath;
+        return false;
+    }
+    
+    QByteArray data = file.readAll();
+    
+    if (QFileInfo(filePath).suffix() == "cbor") {
+        QCborParserError error;
+        QCborValue value = QCborValue::fromCbor(data, &error);
+        if (error.error != QCborError::NoError || !value.isMap()) {
+            qDebug() << "Invalid project file format:" << filePath << error.errorString();
+            return false;
+        }
+        *this = fromCbor(value.toMap());
+        return true;
+    }
+    
+    QJsonDocument doc = QJsonDocument::fromJson(data);
+    if (doc.isNull() || !doc.isObject()) {
+        qDebug() << "Invalid project file format:" << filePath;
+        return false;
+    }
+    
+    *this = fromJsonObject(doc.object());
+    return true;
+}
+
+bool ProjectMetadata::saveToFile(const QString& filePath) const
+{
+    // Written to a temporary file and renamed, so a crash never leaves a torn file
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qDebug() << "Cannot save project file:" << filePath;
+        return false;
+    }
+    
+    QByteArray data = (QFileInfo(filePath).suffix() == "cbor") ? toCborData() : toJsonData();
+    if (file.write(data) != data.size()) {
+        file.cancelWriting();
+    }
+    
+    return file.commit();
+}
@@ -0,0 +1,122 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef PROJECTMETADATA_H
+#define PROJECTMETADATA_H
+
+#include <QString>
+#include <QList>
+#include <QHash>
+#include <QCborMap>
+#include <QJsonObject>
+#include <QFlags>
+#include <QByteArray>
+
+struct ChapterManifestEntry {
+    QString id;        // Stable across renames and reorders
+    QString fileName;  // Relative to the chapters directory
+};
+
+// Typed in-memory model of a project's metadata. Lookups are plain member
+// or hash accesses, setters record which fields changed, and the model
+// persists as compact CBOR with a JSON form kept for project.json.
+class ProjectMetadata
+{
+public:
+    enum Field {
+        NoFields = 0x0,
+        InfoField = 0x1,          // Name, version, author, description, timestamps
+        WordTargetsField = 0x2,
+        SettingsField = 0x4,
+        ChapterOrderField = 0x8,
+        AllFields = 0xF
+    };
+    Q_DECLARE_FLAGS(Fields, Field)
+
+    ProjectMetadata();
+
+    void clear();
+
+    // Project information
+    QString getName() const { return m_name; }
+    void setName(const QString& name);
+    QString getVersion() const { return m_version; }
+    QString getAuthor() const { return m_author; }
+    void setAuthor(const QString& author);
+    QString getDescription() const { return m_description; }
+    void setDescription(const QString& description);
+    QString getCreated() const { return m_created; }
+    QString getModified() const { return m_modified; }
+    qint64 getGeneration() const { return m_generation; }   // Bumped by every touchModified()
+    void touchModified();
+
+    // Word count targets
+    int getProjectWordTarget() const { return m_projectWordTarget; }
+    void setProjectWordTarget(int target);
+    int getChapterWordTarget(const QString& chapter) const { return m_chapterWordTargets.value(chapter, 0); }
+    const QHash<QString, int>& getChapterWordTargets() const { return m_chapterWordTargets; }
+    void setChapterWordTarget(const QString& chapter, int target);
+
+    // Settings
+    bool isAutoSaveEnabled() const { return m_autoSave; }
+    void setAutoSaveEnabled(bool enabled);
+    int getBackupCount() const { return m_backupCount; }
+    void setBackupCount(int count);
+    bool isComputedHeadingNumbering() const { return m_computedHeadingNumbering; }
+    void setComputedHeadingNumbering(bool computed);
+
+    // Chapter ordering manifest
+    const QList<ChapterManifestEntry>& getChapterOrder() const { return m_chapterOrder; }
+    void setChapterOrder(const QList<ChapterManifestEntry>& order);
+    bool hasChapterOrder() const { return m_hasChapterOrder; }
+
+    // Dirty-field tracking
+    Fields getDirtyFields() const { return m_dirtyFields; }
+    bool isDirty() const { return m_dirtyFields != NoFields; }
+    void markDirty(Fields fields) { m_dirtyFields |= fields; }
+    void clearDirty() { m_dirtyFields = NoFields; }
+
+    // Serialization
+    QCborMap toCbor() const;
+    QJsonObject toJsonObject() const;
+    static ProjectMetadata fromCbor(const QCborMap& map);
+    static ProjectMetadata fromJsonObject(const QJsonObject& object);
+    QByteArray toCborData() const;
+    QByteArray toJsonData() const;
+
+    // File persistence; the format follows the suffix (.cbor or .json)
+    bool loadFromFile(const QString& filePath);
+    bool saveToFile(const QString& filePath) const;
+
+private:
+    QString m_name;
+    QString m_version;
+    QString m_created;
+    QString m_modified;
+    qint64 m_generation;
+    QString m_author;
+    QString m_description;
+
+    int m_projectWordTarget;
+    QHash<QString, int> m_chapterWordTargets;
+
+    bool m_autoSave;
+    int m_backupCount;
+    bool m_computedHeadingNumbering;
+
+    QList<ChapterManifestEntry> m_chapterOrder;
+    bool m_hasChapterOrder;
+
+    // Keys this version does not model, kept so saving does not drop them
+    QCborMap m_extraFields;
+    QCborMap m_extraSettings;
+
+    Fields m_dirtyFields;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(ProjectMetadata::Fields)
+
+#endif // PROJECTMETADATA_H
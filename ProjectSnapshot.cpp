@@ -0,0 +1,67 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "ProjectSnapshot.h"
+#include <QDir>
+
+ProjectSnapshot::ProjectSnapshot()
+    : m_generation(0)
+    , m_projectWordTarget(0)
+    , m_computedHeadingNumbering(false)
+{
+}
+
+QStringList ProjectSnapshot::getChapterFiles() const
+{
+    QStringList files;
+    for (const ChapterManifestEntry& entry : m_chapterOrder) {
+        files.append(entry.fileName);
+    }
+    
+    return files;
+}
+
+QStringList ProjectSnapshot::getChapterPaths() const
+{
+    QStringList paths;
+    if (isEmpty()) {
+        return paths;
+    }
+    
+    QDir chaptersDir(QDir(m_projectPath).filePath("chapters"));
+    for (const ChapterManifestEntry& entry : m_chapterOrder) {
+        paths.append(chaptersDir.filePath(entry.fileName));
+    }
+    
+    return paths;
+}
+
+QString ProjectSnapshot::getChapterId(const QString& chapterFile) const
+{
+    for (const ChapterManifestEntry& entry : m_chapterOrder) {
+        if (entry.fileName == chapterFile) {
+            return entry.id;
+        }
+    }
+    
+    return QString();
+}
+
+qint64 ProjectSnapshot::estimateMemoryUsage() const
+{
+    qint64 bytes = sizeof(ProjectSnapshot);
+    for (const ChapterManifestEntry& entry : m_chapterOrder) {
+        bytes += sizeof(ChapterManifestEntry) + (entry.id.size() + entry.fileName.size()) * static_cast<qint64>(sizeof(QChar));
+    }
+    for (auto it = m_chapterWordTargets.constBegin(); it != m_chapterWordTargets.constEnd(); ++it) {
+        bytes += sizeof(QString) + sizeof(int) + sizeof(void*) + it.key().size() * static_cast<qint64>(sizeof(QChar));
+    }
+    for (const QString& tag : m_hashtags) {
+        bytes += sizeof(QString) + tag.size() * static_cast<qint64>(sizeof(QChar));
+    }
+    
+    return bytes;
+}
@@ -0,0 +1,68 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef PROJECTSNAPSHOT_H
+#define PROJECTSNAPSHOT_H
+
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QHash>
+#include "ProjectMetadata.h"
+#include "CharacterDatabase.h"
+
+// Immutable view of a project at one moment: chapter manifest, word
+// targets, hashtags and characters. ProjectManager builds a new one on
+// every change and publishes it by swapping a shared pointer, so worker
+// threads can hold one for as long as a job runs without any locking.
+class ProjectSnapshot
+{
+public:
+    ProjectSnapshot();
+
+    quint64 getGeneration() const { return m_generation; }   // Increases with every publish
+    bool isEmpty() const { return m_projectPath.isEmpty(); }
+
+    // Project information
+    QString getProjectPath() const { return m_projectPath; }
+    QString getProjectName() const { return m_projectName; }
+    QString getTitle() const { return m_title; }
+    QString getAuthor() const { return m_author; }
+
+    // Chapter manifest
+    const QList<ChapterManifestEntry>& getChapterOrder() const { return m_chapterOrder; }
+    QStringList getChapterFiles() const;
+    QStringList getChapterPaths() const;   // Absolute, in manifest order
+    QString getChapterId(const QString& chapterFile) const;
+
+    // Word count targets
+    int getProjectWordTarget() const { return m_projectWordTarget; }
+    int getChapterWordTarget(const QString& chapter) const { return m_chapterWordTargets.value(chapter, 0); }
+    bool isComputedHeadingNumbering() const { return m_computedHeadingNumbering; }
+
+    // Hashtags and characters
+    const QStringList& getHashtags() const { return m_hashtags; }
+    const QList<CharacterRecord>& getCharacters() const { return m_characters; }
+
+    qint64 estimateMemoryUsage() const;   // Characters are counted by the database they share with
+
+private:
+    friend class ProjectManager;   // The only writer, before publishing
+
+    quint64 m_generation;
+    QString m_projectPath;
+    QString m_projectName;
+    QString m_title;
+    QString m_author;
+    QList<ChapterManifestEntry> m_chapterOrder;
+    int m_projectWordTarget;
+    QHash<QString, int> m_chapterWordTargets;
+    bool m_computedHeadingNumbering;
+    QStringList m_hashtags;
+    QList<CharacterRecord> m_characters;
+};
+
+#endif // PROJECTSNAPSHOT_H
@@ -6,6 +6,10 @@
 
 #include "ProjectTreeWidget.h"
 #include "ProjectManager.h"
+#include "UpdateManager.h"
+#include "CharacterDatabase.h"
+#include "CharacterMentionIndex.h"
+#include "ManuscriptPaginator.h"
 #include <QHeaderView>
 #include <QInputDialog>
 #include <QMessageBox>
@@ -19,12 +23,18 @@ ProjectTreeWidget::ProjectTreeWidget(QWidget *parent)
     : QTreeWidget(parent)
     , m_currentContextItem(nullptr)
     , m_dragDropEnabled(true)
+    , m_updateManager(nullptr)
+    , m_mentionIndex(nullptr)
+    , m_paginator(nullptr)
 {
     setupContextMenus();
     setupDragDrop();
     
     // Configure tree widget
-    setHeaderLabel("Project Structure");
+    setHeaderLabels({"Project Structure", "Pages"});
+    header()->setStretchLastSection(false);
+    header()->setSectionResizeMode(0, QHeaderView::Stretch);
+    header()->setSectionResizeMode(1, QHeaderView::ResizeToContents);
     
     // Set context menu policy
     setContextMenuPolicy(Qt::CustomContextMenu);
@@ -95,11 +105,8 @@ void ProjectTreeWidget::removeProject(const QString& projectPath)
         delete item;
         m_projectItems.remove(projectPath);
         
-        // Clean up project manager if exists
-        if (m_projectManagers.contains(projectPath)) {
-            delete m_projectManagers[projectPath];
-            m_projectManagers.remove(projectPath);
-        }
+        // Forget the project manager; its owner controls its lifetime
+        m_projectManagers.remove(projectPath);
         
         qDebug() << "Removed project from tree:" << projectPath;
     }
@@ -129,6 +136,26 @@ void ProjectTreeWidget::refreshAllProjects()
     }
 }
 
+void ProjectTreeWidget::setProjectManager(const QString& projectPath, ProjectManager* manager)
+{
+    if (manager) {
+        m_projectManagers[projectPath] = manager;
+    } else {
+        m_projectManagers.remove(projectPath);
+    }
+}
+
+void ProjectTreeWidget::setActiveProject(const QString& projectPath)
+{
+    if (m_activeProjectPath == projectPath) {
+        return;
+    }
+    
+    m_activeProjectPath = projectPath;
+    updateCharacterMentions();
+    updatePageCounts();
+}
+
 void ProjectTreeWidget::expandProject(const QString& projectPath)
 {
     if (m_projectItems.contains(projectPath)) {
@@ -290,6 +317,9 @@ void ProjectTreeWidget::onItemDoubleClicked(QTreeWidgetItem* item, int column)
         case ResearchItem:
             emit itemOpenRequested(filePath);
             break;
+        case CorkboardItem:
+            emit corkboardOpenRequested(filePath);
+            break;
     }
 }
 
@@ -334,6 +364,9 @@ void ProjectTreeWidget::setupContextMenus()
     m_newResearchAction = new QAction("New Research", this);
     connect(m_newResearchAction, &QAction::triggered, this, &ProjectTreeWidget::createNewResearch);
     
+    m_editAliasesAction = new QAction("Edit Aliases...", this);
+    connect(m_editAliasesAction, &QAction::triggered, this, &ProjectTreeWidget::editCharacterAliases);
+    
     m_renameAction = new QAction("Rename", this);
     connect(m_renameAction, &QAction::triggered, this, &ProjectTreeWidget::renameItem);
     
@@ -374,6 +407,8 @@ void ProjectTreeWidget::setupContextMenus()
     m_subsectionMenu->addAction(m_moveDownAction);
     
     m_characterMenu = new QMenu(this);
+    m_characterMenu->addAction(m_editAliasesAction);
+    m_characterMenu->addSeparator();
     m_characterMenu->addAction(m_renameAction);
     m_characterMenu->addAction(m_deleteAction);
     
@@ -426,25 +461,150 @@ void ProjectTreeWidget::populateChapters(QTreeWidgetItem* chaptersFolder, const
         return;
     }
     
-    QStringList filters;
-    filters << "*.md" << "*.txt";
-    QFileInfoList files = chaptersDir.entryInfoList(filters, QDir::Files, QDir::Name);
+    // Use the project's chapter manifest order when available
+    QFileInfoList files;
+    ProjectManager* manager = m_projectManagers.value(projectPath, nullptr);
+    if (manager && manager->getCurrentProjectPath() == projectPath) {
+        for (const QString& fileName : manager->getChapterFiles()) {
+            files.append(QFileInfo(chaptersDir.filePath(fileName)));
+        }
+    } else {
+        QStringList filters;
+        filters << "*.md" << "*.txt";
+        files = chaptersDir.entryInfoList(filters, QDir::Files, QDir::Name);
+    }
     
     for (const QFileInfo& fileInfo : files) {
         QTreeWidgetItem* chapterItem = createChapterItem(fileInfo.baseName(), fileInfo.absoluteFilePath());
         chaptersFolder->addChild(chapterItem);
+        if (m_paginator) {
+            setPageCountText(chapterItem, m_paginator->getPageCount(fileInfo.absoluteFilePath()));
+        }
+        
+        if (!m_updateManager) {
+            chapterItem->addChild(createSubsectionItem("Beginning", 1));
+            chapterItem->addChild(createSubsectionItem("Middle", 2));
+            chapterItem->addChild(createSubsectionItem("End", 3));
+            continue;
+        }
         
-        chapterItem->addChild(createSubsectionItem("Beginning", 1));
-        chapterItem->addChild(createSubsectionItem("Middle", 2));
-        chapterItem->addChild(createSubsectionItem("End", 3));
+        // Subsections come from the cached outline; numbers are derived from
+        // position so they stay correct without rewriting any headings
+        int chapterNumber = chaptersFolder->childCount();
+        const QStringList subsections = m_updateManager->getChapterOutline(fileInfo.absoluteFilePath()).subsections;
+        for (int i = 0; i < subsections.size(); ++i) {
+            QString label = QString("%1.%2").arg(chapterNumber).arg(i + 1);
+            if (!subsections[i].isEmpty()) {
+                label += " " + subsections[i];
+            }
+            chapterItem->addChild(createSubsectionItem(label, i + 1));
+        }
     }
+    
+    updateChapterNumbers(chaptersFolder);
 }
 
 void ProjectTreeWidget::populateCharacters(QTreeWidgetItem* charactersFolder, const QString& projectPath)
 {
-    Q_UNUSED(projectPath)
-    charactersFolder->addChild(createCharacterItem("Main Character"));
-    charactersFolder->addChild(createCharacterItem("Supporting Character"));
+    ProjectManager* manager = m_projectManagers.value(projectPath, nullptr);
+    if (!manager || manager->getCurrentProjectPath() != projectPath) {
+        return;
+    }
+    
+    for (const CharacterRecord& record : manager->getCharacterDatabase()->getCharacters()) {
+        QTreeWidgetItem* characterItem = createCharacterItem(record.name);
+        characterItem->setData(0, Qt::UserRole, record.id);
+        characterItem->setToolTip(0, characterToolTip(record, projectPath == m_activeProjectPath));
+        charactersFolder->addChild(characterItem);
+    }
+}
+
+void ProjectTreeWidget::updateCharacterMentions()
+{
+    for (auto it = m_projectItems.constBegin(); it != m_projectItems.constEnd(); ++it) {
+        ProjectManager* manager = m_projectManagers.value(it.key(), nullptr);
+        if (!manager || manager->getCurrentProjectPath() != it.key()) {
+            continue;
+        }
+        
+        QTreeWidgetItem* projectItem = it.value();
+        for (int i = 0; i < projectItem->childCount(); ++i) {
+            QTreeWidgetItem* folder = projectItem->child(i);
+            if (folder->type() != CharactersFolderItem) {
+                continue;
+            }
+            
+            for (int j = 0; j < folder->childCount(); ++j) {
+                QTreeWidgetItem* characterItem = folder->child(j);
+                CharacterRecord record = manager->getCharacterDatabase()->getCharacter(getItemPath(characterItem));
+                if (!record.id.isEmpty()) {
+                    characterItem->setToolTip(0, characterToolTip(record, it.key() == m_activeProjectPath));
+                }
+            }
+        }
+    }
+}
+
+void ProjectTreeWidget::updatePageCounts()
+{
+    if (!m_paginator) {
+        return;
+    }
+    
+    for (auto it = m_projectItems.constBegin(); it != m_projectItems.constEnd(); ++it) {
+        ProjectManager* manager = m_projectManagers.value(it.key(), nullptr);
+        if (!manager || manager->getCurrentProjectPath() != it.key()) {
+            continue;
+        }
+        
+        // The paginator only covers the active project; other rows show no estimate
+        bool active = (it.key() == m_activeProjectPath);
+        QTreeWidgetItem* projectItem = it.value();
+        setPageCountText(projectItem, active ? m_paginator->getTotalPages() : -1);
+        for (int i = 0; i < projectItem->childCount(); ++i) {
+            QTreeWidgetItem* folder = projectItem->child(i);
+            if (folder->type() != ChaptersFolderItem) {
+                continue;
+            }
+            
+            for (int j = 0; j < folder->childCount(); ++j) {
+                QTreeWidgetItem* chapterItem = folder->child(j);
+                setPageCountText(chapterItem, active ? m_paginator->getPageCount(getItemPath(chapterItem)) : -1);
+            }
+        }
+    }
+}
+
+void ProjectTreeWidget::setPageCountText(QTreeWidgetItem* item, int pages) const
+{
+    // Unknown until the first pagination pass finishes
+    item->setText(1, pages < 0 ? QString() : QString::number(pages));
+    item->setTextAlignment(1, Qt::AlignRight | Qt::AlignVCenter);
+    item->setToolTip(1, "Estimated pages in standard manuscript format");
+}
+
+QString ProjectTreeWidget::characterToolTip(const CharacterRecord& record, bool withMentions) const
+{
+    QStringList lines;
+    lines << record.name;
+    if (!record.aliases.isEmpty()) {
+        lines << "Also: " + record.aliases.join(", ");
+    }
+    
+    // The mention index only covers the active project
+    if (withMentions && m_mentionIndex) {
+        int total = m_mentionIndex->getMentionCount(record.id);
+        if (total == 0) {
+            lines << "Not mentioned yet";
+        } else {
+            int chapterCount = m_mentionIndex->getChapterCounts(record.id).size();
+            lines << QString("Mentions: %1 in %2 chapter(s)").arg(total).arg(chapterCount);
+            lines << "First: " + QFileInfo(m_mentionIndex->getFirstAppearance(record.id).chapterPath).baseName();
+            lines << "Last: " + QFileInfo(m_mentionIndex->getLastAppearance(record.id).chapterPath).baseName();
+        }
+    }
+    
+    return lines.join('\n');
 }
 
 void ProjectTreeWidget::populateResearch(QTreeWidgetItem* researchFolder, const QString& projectPath)
@@ -469,15 +629,20 @@ void ProjectTreeWidget::populateResearch(QTreeWidgetItem* researchFolder, const
 
 void ProjectTreeWidget::populateCorkboard(QTreeWidgetItem* corkboardFolder, const QString& projectPath)
 {
-    Q_UNUSED(projectPath)
+    QDir corkboardDir(QDir(projectPath).filePath("corkboard"));
+    QStringList boardFiles = corkboardDir.entryList({"*.json"}, QDir::Files, QDir::Name);
     
-    QTreeWidgetItem* plotIdeas = new QTreeWidgetItem(CorkboardItem);
-    plotIdeas->setText(0, "Plot Ideas");
-    corkboardFolder->addChild(plotIdeas);
+    // Every project starts with one board; its file appears on the first card
+    if (boardFiles.isEmpty()) {
+        boardFiles.append("Scene_Cards.json");
+    }
     
-    QTreeWidgetItem* sceneCards = new QTreeWidgetItem(CorkboardItem);
-    sceneCards->setText(0, "Scene Cards");
-    corkboardFolder->addChild(sceneCards);
+    for (const QString& boardFile : boardFiles) {
+        QTreeWidgetItem* boardItem = new QTreeWidgetItem(CorkboardItem);
+        boardItem->setText(0, QFileInfo(boardFile).completeBaseName().replace('_', ' '));
+        boardItem->setData(0, Qt::UserRole, corkboardDir.filePath(boardFile));
+        corkboardFolder->addChild(boardItem);
+    }
 }
 
 QString ProjectTreeWidget::getItemPath(QTreeWidgetItem* item) const
@@ -557,7 +722,13 @@ void ProjectTreeWidget::updateChapterNumbers(QTreeWidgetItem* chaptersFolder)
     if (!chaptersFolder || chaptersFolder->type() != ChaptersFolderItem) {
         return;
     }
-    // TODO: Implement chapter renumbering logic
+    
+    // Display numbers follow tree position; nothing on disk is renamed
+    for (int i = 0; i < chaptersFolder->childCount(); ++i) {
+        QTreeWidgetItem* chapterItem = chaptersFolder->child(i);
+        chapterItem->setData(0, Qt::UserRole + 1, i + 1);
+        chapterItem->setToolTip(0, QString("Chapter %1").arg(i + 1));
+    }
 }
 
 void ProjectTreeWidget::saveTreeState()
@@ -633,6 +804,15 @@ void ProjectTreeWidget::createNewCharacter()
     }
 }
 
+void ProjectTreeWidget::editCharacterAliases()
+{
+    if (!m_currentContextItem || m_currentContextItem->type() != CharacterItem) {
+        return;
+    }
+    
+    emit characterAliasesEditRequested(getProjectPath(m_currentContextItem), getItemPath(m_currentContextItem));
+}
+
 void ProjectTreeWidget::createNewResearch()
 {
     // TODO: Implement research item creation
@@ -789,6 +969,7 @@ void ProjectTreeWidget::moveItemUp()
         
         if (parent->type() == ChaptersFolderItem) {
             updateChapterNumbers(parent);
+            emit itemMoved(QString::number(currentIndex), QString::number(currentIndex - 1), ChapterItem, getProjectPath(parent));
         }
     }
 }
@@ -809,6 +990,7 @@ void ProjectTreeWidget::moveItemDown()
         
         if (parent->type() == ChaptersFolderItem) {
             updateChapterNumbers(parent);
+            emit itemMoved(QString::number(currentIndex), QString::number(currentIndex + 1), ChapterItem, getProjectPath(parent));
         }
     }
 }
@@ -833,7 +1015,7 @@ void ProjectTreeWidget::dropEvent(QDropEvent* event)
         newParent && newParent->type() == ChaptersFolderItem &&
         originalParent == newParent && originalIndex != newIndex) {
         
-        emit itemMoved(QString::number(originalIndex), QString::number(newIndex), ChapterItem);
+        emit itemMoved(QString::number(originalIndex), QString::number(newIndex), ChapterItem, getProjectPath(newParent));
     }
     
     event->accept();
@@ -21,6 +21,10 @@
 #include <QHash>
 
 class ProjectManager;
+class UpdateManager;
+class CharacterMentionIndex;
+class ManuscriptPaginator;
+struct CharacterRecord;
 
 class ProjectTreeWidget : public QTreeWidget
 {
@@ -48,6 +52,13 @@ public:
     void removeProject(const QString& projectPath);
     void refreshProject(const QString& projectPath);
     void refreshAllProjects();
+    void setProjectManager(const QString& projectPath, ProjectManager* manager);
+    void setActiveProject(const QString& projectPath);   // The one the shared index and paginator describe
+    void setUpdateManager(UpdateManager* updateManager) { m_updateManager = updateManager; }
+    void setMentionIndex(CharacterMentionIndex* mentionIndex) { m_mentionIndex = mentionIndex; }
+    void updateCharacterMentions();
+    void setPaginator(ManuscriptPaginator* paginator) { m_paginator = paginator; }
+    void updatePageCounts();
     
     // Tree operations
     void expandProject(const QString& projectPath);
@@ -66,9 +77,11 @@ signals:
     void chapterCreated(const QString& projectPath, const QString& chapterName);
     void subsectionCreated(const QString& chapterPath, const QString& subsectionTitle);
     void characterCreated(const QString& projectPath, const QString& characterName);
-    void itemMoved(const QString& fromPath, const QString& toPath, ItemType type);
+    void characterAliasesEditRequested(const QString& projectPath, const QString& characterId);
+    void itemMoved(const QString& fromPath, const QString& toPath, ItemType type, const QString& projectPath);
     void itemRenamed(const QString& oldName, const QString& newName, ItemType type, const QString& filePath);
     void itemDeleted(const QString& path, ItemType type);
+    void corkboardOpenRequested(const QString& boardPath);
 
 protected:
     void contextMenuEvent(QContextMenuEvent* event) override;
@@ -86,6 +99,7 @@ private slots:
     void createNewSubsection();
     void createNewCharacter();
     void createNewResearch();
+    void editCharacterAliases();
     void renameItem();
     void deleteItem();
     void moveItemUp();
@@ -107,6 +121,8 @@ private:
     QTreeWidgetItem* findChaptersFolder(QTreeWidgetItem* projectItem) const;
     bool canDropOn(QTreeWidgetItem* target, ItemType sourceType) const;
     void updateChapterNumbers(QTreeWidgetItem* chaptersFolder);
+    QString characterToolTip(const CharacterRecord& record, bool withMentions) const;
+    void setPageCountText(QTreeWidgetItem* item, int pages) const;
     void saveTreeState();
     void restoreTreeState();
     
@@ -123,6 +139,7 @@ private:
     QAction* m_newSubsectionAction;
     QAction* m_newCharacterAction;
     QAction* m_newResearchAction;
+    QAction* m_editAliasesAction;
     QAction* m_renameAction;
     QAction* m_deleteAction;
     QAction* m_moveUpAction;
@@ -133,8 +150,12 @@ private:
     QTreeWidgetItem* m_currentContextItem;
     bool m_dragDropEnabled;
     
-    // Project managers for each open project
+    // Project managers for each open project (not owned)
     QHash<QString, ProjectManager*> m_projectManagers;
+    UpdateManager* m_updateManager;  // Supplies cached chapter outlines (not owned)
+    CharacterMentionIndex* m_mentionIndex;  // Supplies mention counts (not owned)
+    ManuscriptPaginator* m_paginator;  // Supplies manuscript page counts (not owned)
+    QString m_activeProjectPath;
 };
 
 #endif // PROJECTTREEWIDGET_H
\ No newline at end of file
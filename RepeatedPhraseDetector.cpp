@@ -0,0 +1,382 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "RepeatedPhraseDetector.h"
+#include "WordFrequencyAnalyzer.h"
+#include "TaskScheduler.h"
+#include <QFile>
+#include <QSet>
+#include <QTextStream>
+#include <QDebug>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace {
+
+// Rabin-Karp base; arithmetic wraps modulo 2^64
+const quint64 HASH_BASE = 0x100000001B3ULL;
+
+}
+
+RepeatedPhraseDetector::RepeatedPhraseDetector(QObject *parent)
+    : QObject(parent)
+    , m_tokenize(this)
+    , m_scan(this)
+    , m_detectQueued(false)
+{
+}
+
+RepeatedPhraseDetector::~RepeatedPhraseDetector() = default;
+
+void RepeatedPhraseDetector::detect(const QStringList& chapterPaths, const QHash<QString, QString>& openTexts)
+{
+    m_chapterOrder = chapterPaths;
+    m_openTexts = openTexts;
+    
+    // Only one run at a time; the newest request runs when it ends
+    if (isDetecting()) {
+        m_detectQueued = true;
+        m_tokenize.cancel();
+        m_scan.cancel();
+        return;
+    }
+    
+    if (chapterPaths.isEmpty()) {
+        m_phrases.clear();
+        emit detectionFinished();
+        return;
+    }
+    
+    QHash<QString, QString> texts = m_openTexts;
+    m_openTexts.clear();
+    
+    // Stage one: tokenize and hash every chapter on the worker pool
+    m_tokenize.start(TaskScheduler::instance()->mapped(TaskScheduler::AnalysisLane, "phrases:tokens", chapterPaths, [texts](const QString& chapterPath) {
+        auto openText = texts.constFind(chapterPath);
+        if (openText != texts.constEnd()) {
+            return tokenize(chapterPath, *openText);
+        }
+        
+        QFile file(chapterPath);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            qDebug() << "Cannot read chapter for phrase detection:" << chapterPath;
+            return tokenize(chapterPath, QString());
+        }
+        QTextStream in(&file);
+        return tokenize(chapterPath, in.readAll());
+    }), [this]() { onTokenizeFinished(); });
+}
+
+void RepeatedPhraseDetector::clear()
+{
+    m_tokenize.stop();
+    m_scan.stop();
+    m_detectQueued = false;
+    m_chapterOrder.clear();
+    m_openTexts.clear();
+    m_stream.reset();
+    m_phrases.clear();
+    emit detectionFinished();
+}
+
+RepeatedPhraseDetector::Results RepeatedPhraseDetector::takeResults()
+{
+    m_tokenize.stop();
+    m_scan.stop();
+    m_detectQueued = false;
+    m_openTexts.clear();
+    m_stream.reset();
+    
+    Results results;
+    results.chapterOrder = std::exchange(m_chapterOrder, {});
+    results.phrases = std::exchange(m_phrases, {});
+    return results;
+}
+
+void RepeatedPhraseDetector::restoreResults(Results results)
+{
+    m_tokenize.stop();
+    m_scan.stop();
+    m_detectQueued = false;
+    m_openTexts.clear();
+    m_stream.reset();
+    
+    m_chapterOrder = std::move(results.chapterOrder);
+    m_phrases = std::move(results.phrases);
+    emit detectionFinished();
+}
+
+qint64 RepeatedPhraseDetector::Results::estimateMemoryUsage() const
+{
+    // Occurrence paths are shared with the chapter list
+    qint64 bytes = 0;
+    for (const RepeatedPhrase& phrase : phrases) {
+        bytes += sizeof(RepeatedPhrase) + phrase.text.size() * static_cast<qint64>(sizeof(QChar));
+        bytes += phrase.occurrences.size() * static_cast<qint64>(sizeof(PhraseOccurrence));
+    }
+    
+    return bytes;
+}
+
+void RepeatedPhraseDetector::onTokenizeFinished()
+{
+    QFuture<ChapterTokens> future = m_tokenize.finish();
+    
+    if (restartIfQueued()) {
+        return;
+    }
+    
+    // mapped() keeps input order, so chapters stay in reading order
+    auto stream = std::make_shared<TokenStream>();
+    stream->chapters = future.results();
+    stream->chapterStart.reserve(stream->chapters.size());
+    for (const ChapterTokens& chapter : std::as_const(stream->chapters)) {
+        stream->chapterStart.append(stream->totalTokens);
+        stream->totalTokens += chapter.hashes.size();
+    }
+    m_stream = stream;
+    
+    // Stage two: each phrase length is an independent pass over the stream
+    QList<int> wordCounts;
+    for (int n = MIN_PHRASE_WORDS; n <= MAX_PHRASE_WORDS; ++n) {
+        wordCounts.append(n);
+    }
+    
+    std::shared_ptr<const TokenStream> shared = stream;
+    m_scan.start(TaskScheduler::instance()->mapped(TaskScheduler::AnalysisLane, "phrases:scan", wordCounts, [shared](int wordCount) {
+        return scanPhraseLength(*shared, wordCount);
+    }), [this]() { onScanFinished(); });
+}
+
+void RepeatedPhraseDetector::onScanFinished()
+{
+    QFuture<QList<PhraseHit>> future = m_scan.finish();
+    
+    if (restartIfQueued()) {
+        return;
+    }
+    
+    QList<PhraseHit> hits;
+    const QList<QList<PhraseHit>> results = future.results();
+    for (const QList<PhraseHit>& lengthHits : results) {
+        hits.append(lengthHits);
+    }
+    
+    buildPhrases(hits);
+    m_stream.reset();
+    emit detectionFinished();
+}
+
+bool RepeatedPhraseDetector::restartIfQueued()
+{
+    if (!m_detectQueued) {
+        return false;
+    }
+    
+    m_detectQueued = false;
+    detect(m_chapterOrder, m_openTexts);
+    return true;
+}
+
+RepeatedPhraseDetector::ChapterTokens RepeatedPhraseDetector::tokenize(const QString& chapterPath, const QString& text)
+{
+    ChapterTokens tokens;
+    tokens.chapterPath = chapterPath;
+    tokens.text = text;
+    
+    // Same word rule as the frequency analyzer: letter runs with inner apostrophes
+    QList<bool> common;
+    int i = 0;
+    while (i < text.size()) {
+        if (!text[i].isLetter()) {
+            ++i;
+            continue;
+        }
+        
+        int start = i;
+        while (i < text.size() && (text[i].isLetter() ||
+               ((text[i] == QLatin1Char('\'') || text[i] == QChar(0x2019)) &&
+                i + 1 < text.size() && text[i + 1].isLetter()))) {
+            ++i;
+        }
+        
+        QString word = text.mid(start, i - start).toLower();
+        word.replace(QChar(0x2019), QLatin1Char('\''));
+        tokens.hashes.append(static_cast<quint64>(qHash(word)));
+        tokens.positions.append(start);
+        tokens.lengths.append(i - start);
+        common.append(WordFrequencyAnalyzer::isCommonWord(word));
+    }
+    
+    tokens.common.resize(common.size());
+    for (int j = 0; j < common.size(); ++j) {
+        tokens.common.setBit(j, common[j]);
+    }
+    
+    return tokens;
+}
+
+QList<RepeatedPhraseDetector::PhraseHit> RepeatedPhraseDetector::scanPhraseLength(const TokenStream& stream, int wordCount)
+{
+    QList<PhraseHit> hits;
+    
+    quint64 highPower = 1;   // HASH_BASE^(wordCount - 1)
+    for (int i = 1; i < wordCount; ++i) {
+        highPower *= HASH_BASE;
+    }
+    
+    // Windows never span chapters, but the last-seen table does, so repeats
+    // near a chapter break are still found
+    QHash<quint64, int> lastSeen;
+    lastSeen.reserve(stream.totalTokens);
+    
+    for (int c = 0; c < stream.chapters.size(); ++c) {
+        const ChapterTokens& chapter = stream.chapters[c];
+        const int count = chapter.hashes.size();
+        if (count < wordCount) {
+            continue;
+        }
+        
+        quint64 hash = 0;
+        for (int i = 0; i < wordCount; ++i) {
+            hash = hash * HASH_BASE + chapter.hashes[i];
+        }
+        
+        for (int i = 0; ; ++i) {
+            // Phrases made only of function words ("and then he") are noise
+            bool allCommon = true;
+            for (int j = i; j < i + wordCount && allCommon; ++j) {
+                allCommon = chapter.common.testBit(j);
+            }
+            
+            if (!allCommon) {
+                const int global = stream.chapterStart[c] + i;
+                auto seen = lastSeen.find(hash);
+                if (seen == lastSeen.end()) {
+                    lastSeen.insert(hash, global);
+                } else {
+                    const int gap = global - seen.value();
+                    if (gap >= wordCount && gap <= WINDOW_WORDS && sameTokens(stream, seen.value(), global, wordCount)) {
+                        hits.append({wordCount, seen.value(), global});
+                    }
+                    seen.value() = global;
+                }
+            }
+            
+            if (i + wordCount >= count) {
+                break;
+            }
+            hash = (hash - chapter.hashes[i] * highPower) * HASH_BASE + chapter.hashes[i + wordCount];
+        }
+    }
+    
+    return hits;
+}
+
+bool RepeatedPhraseDetector::sameTokens(const TokenStream& stream, int a, int b, int wordCount)
+{
+    // Rules out rolling-hash collisions; token hashes are compared directly
+    auto [chapterA, tokenA] = locate(stream, a);
+    auto [chapterB, tokenB] = locate(stream, b);
+    const QList<quint64>& hashesA = stream.chapters[chapterA].hashes;
+    const QList<quint64>& hashesB = stream.chapters[chapterB].hashes;
+    for (int i = 0; i < wordCount; ++i) {
+        if (hashesA[tokenA + i] != hashesB[tokenB + i]) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+std::pair<int, int> RepeatedPhraseDetector::locate(const TokenStream& stream, int globalIndex)
+{
+    auto it = std::upper_bound(stream.chapterStart.constBegin(), stream.chapterStart.constEnd(), globalIndex);
+    int chapter = static_cast<int>(it - stream.chapterStart.constBegin()) - 1;
+    return {chapter, globalIndex - stream.chapterStart[chapter]};
+}
+
+void RepeatedPhraseDetector::buildPhrases(const QList<PhraseHit>& hits)
+{
+    m_phrases.clear();
+    
+    // Longest phrases claim their words first, so "she took a deep breath"
+    // is not also reported as "took a deep" and "a deep breath"
+    QList<PhraseHit> ordered = hits;
+    std::sort(ordered.begin(), ordered.end(), [](const PhraseHit& a, const PhraseHit& b) {
+        return (a.wordCount != b.wordCount) ? a.wordCount > b.wordCount : a.later < b.later;
+    });
+    
+    QBitArray covered(m_stream->totalTokens);
+    QHash<QString, int> phraseIndex;          // Lower-cased phrase -> index in m_phrases
+    QList<QList<int>> occurrenceStarts;       // Global starts already recorded per phrase
+    
+    for (const PhraseHit& hit : std::as_const(ordered)) {
+        bool alreadyCovered = true;
+        for (int i = hit.later; i < hit.later + hit.wordCount && alreadyCovered; ++i) {
+            alreadyCovered = covered.testBit(i);
+        }
+        if (alreadyCovered) {
+            continue;
+        }
+        
+        for (int i = 0; i < hit.wordCount; ++i) {
+            covered.setBit(hit.earlier + i);
+            covered.setBit(hit.later + i);
+        }
+        
+        auto [chapter, token] = locate(*m_stream, hit.earlier);
+        const ChapterTokens& tokens = m_stream->chapters[chapter];
+        int position = tokens.positions[token];
+        int length = tokens.positions[token + hit.wordCount - 1] + tokens.lengths[token + hit.wordCount - 1] - position;
+        QString text = tokens.text.mid(position, length).simplified();
+        
+        QString key = text.toLower();
+        int index = phraseIndex.value(key, -1);
+        if (index < 0) {
+            index = m_phrases.size();
+            phraseIndex.insert(key, index);
+            m_phrases.append({text, hit.wordCount, {}});
+            occurrenceStarts.append(QList<int>());
+        }
+        
+        for (int start : {hit.earlier, hit.later}) {
+            if (occurrenceStarts[index].contains(start)) {
+                continue;
+            }
+            occurrenceStarts[index].append(start);
+            
+            auto [occurrenceChapter, occurrenceToken] = locate(*m_stream, start);
+            const ChapterTokens& occurrenceTokens = m_stream->chapters[occurrenceChapter];
+            int occurrencePosition = occurrenceTokens.positions[occurrenceToken];
+            int last = occurrenceToken + hit.wordCount - 1;
+            m_phrases[index].occurrences.append({occurrenceTokens.chapterPath, occurrencePosition,
+                                                 occurrenceTokens.positions[last] + occurrenceTokens.lengths[last] - occurrencePosition});
+        }
+    }
+    
+    // Occurrences were added longest-first; restore reading order
+    for (int i = 0; i < m_phrases.size(); ++i) {
+        QList<int> order(occurrenceStarts[i].size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            return occurrenceStarts[i][a] < occurrenceStarts[i][b];
+        });
+        
+        QList<PhraseOccurrence> sorted;
+        sorted.reserve(order.size());
+        for (int j : std::as_const(order)) {
+            sorted.append(m_phrases[i].occurrences[j]);
+        }
+        m_phrases[i].occurrences = sorted;
+    }
+    
+    std::stable_sort(m_phrases.begin(), m_phrases.end(), [](const RepeatedPhrase& a, const RepeatedPhrase& b) {
+        return (a.occurrences.size() != b.occurrences.size()) ? a.occurrences.size() > b.occurrences.size()
+                                                              : a.wordCount > b.wordCount;
+    });
+}
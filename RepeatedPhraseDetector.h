@@ -0,0 +1,113 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef REPEATEDPHRASEDETECTOR_H
+#define REPEATEDPHRASEDETECTOR_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QList>
+#include <QBitArray>
+#include <memory>
+#include "TaskWatcher.h"
+
+struct PhraseOccurrence {
+    QString chapterPath;
+    int position = -1;   // Character offset within the chapter
+    int length = 0;
+};
+
+struct RepeatedPhrase {
+    QString text;        // As first written
+    int wordCount = 0;
+    QList<PhraseOccurrence> occurrences;   // Reading order
+};
+
+// Finds 3-8 word phrases that recur within a sliding window of the
+// manuscript. Chapters are tokenized in parallel, then each phrase length
+// is scanned in parallel with a Rabin-Karp rolling hash over token hashes.
+class RepeatedPhraseDetector : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit RepeatedPhraseDetector(QObject *parent = nullptr);
+    ~RepeatedPhraseDetector();
+
+    // Detection; openTexts supplies editor content by chapter path
+    void detect(const QStringList& chapterPaths,
+                const QHash<QString, QString>& openTexts = QHash<QString, QString>());
+    void clear();
+    bool isDetecting() const { return m_tokenize.isRunning() || m_scan.isRunning(); }
+
+    // Results, most repeated first
+    const QList<RepeatedPhrase>& getPhrases() const { return m_phrases; }
+
+    // Results of one project, parked while another project is active
+    struct Results;
+    Results takeResults();                  // Leaves the detector empty
+    void restoreResults(Results results);   // Supersedes any running detection
+
+    // Constants
+    static const int MIN_PHRASE_WORDS = 3;
+    static const int MAX_PHRASE_WORDS = 8;
+    static const int WINDOW_WORDS = 5000;   // Repeats further apart than this are ignored
+
+signals:
+    void detectionFinished();
+
+private slots:
+    void onTokenizeFinished();
+    void onScanFinished();
+
+private:
+    struct ChapterTokens {
+        QString chapterPath;
+        QString text;
+        QList<quint64> hashes;     // Per-token hash of the lower-cased word
+        QList<int> positions;      // Token start offsets into text
+        QList<int> lengths;
+        QBitArray common;          // Set for function words
+    };
+
+    struct TokenStream {
+        QList<ChapterTokens> chapters;   // Reading order
+        QList<int> chapterStart;         // Global index of each chapter's first token
+        int totalTokens = 0;
+    };
+
+    struct PhraseHit {
+        int wordCount;
+        int earlier;   // Global token indices
+        int later;
+    };
+
+    static ChapterTokens tokenize(const QString& chapterPath, const QString& text);
+    static QList<PhraseHit> scanPhraseLength(const TokenStream& stream, int wordCount);
+    static bool sameTokens(const TokenStream& stream, int a, int b, int wordCount);
+    static std::pair<int, int> locate(const TokenStream& stream, int globalIndex);   // (chapter, token)
+    void buildPhrases(const QList<PhraseHit>& hits);
+    bool restartIfQueued();
+
+    QStringList m_chapterOrder;
+    QHash<QString, QString> m_openTexts;            // Editor content for a queued run
+    std::shared_ptr<const TokenStream> m_stream;
+    QList<RepeatedPhrase> m_phrases;
+    TaskWatcher<ChapterTokens> m_tokenize;          // Running while tokenizing
+    TaskWatcher<QList<PhraseHit>> m_scan;           // Running while scanning
+    bool m_detectQueued;
+};
+
+struct RepeatedPhraseDetector::Results {
+    QStringList chapterOrder;
+    QList<RepeatedPhrase> phrases;
+
+    qint64 estimateMemoryUsage() const;
+};
+
+#endif // REPEATEDPHRASEDETECTOR_H
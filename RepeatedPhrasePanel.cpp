@@ -0,0 +1,98 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "RepeatedPhrasePanel.h"
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QFileInfo>
+
+RepeatedPhrasePanel::RepeatedPhrasePanel(QWidget *parent)
+    : QWidget(parent)
+    , m_layout(nullptr)
+    , m_summaryLabel(nullptr)
+    , m_detectButton(nullptr)
+    , m_phraseTree(nullptr)
+{
+    setupUI();
+}
+
+RepeatedPhrasePanel::~RepeatedPhrasePanel()
+{
+}
+
+void RepeatedPhrasePanel::setupUI()
+{
+    m_layout = new QVBoxLayout(this);
+    m_layout->setContentsMargins(4, 4, 4, 4);
+    
+    QHBoxLayout* headerLayout = new QHBoxLayout();
+    m_summaryLabel = new QLabel("No repeated phrases", this);
+    m_detectButton = new QPushButton("Find Repeats", this);
+    m_detectButton->setToolTip(QString("Find %1-%2 word phrases repeated within %3 words")
+                                   .arg(RepeatedPhraseDetector::MIN_PHRASE_WORDS)
+                                   .arg(RepeatedPhraseDetector::MAX_PHRASE_WORDS)
+                                   .arg(RepeatedPhraseDetector::WINDOW_WORDS));
+    headerLayout->addWidget(m_summaryLabel, 1);
+    headerLayout->addWidget(m_detectButton);
+    m_layout->addLayout(headerLayout);
+    
+    m_phraseTree = new QTreeWidget(this);
+    m_phraseTree->setHeaderLabels({"Phrase", "Uses"});
+    m_phraseTree->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+    m_phraseTree->header()->setSectionResizeMode(1, QHeaderView::ResizeToContents);
+    m_layout->addWidget(m_phraseTree);
+    
+    connect(m_detectButton, &QPushButton::clicked, this, &RepeatedPhrasePanel::detectRequested);
+    connect(m_phraseTree, &QTreeWidget::itemActivated, this, &RepeatedPhrasePanel::onItemActivated);
+}
+
+void RepeatedPhrasePanel::setPhrases(const QList<RepeatedPhrase>& phrases)
+{
+    m_phraseTree->clear();
+    
+    QList<QTreeWidgetItem*> items;
+    for (int i = 0; i < phrases.size() && i < MAX_PHRASES; ++i) {
+        const RepeatedPhrase& phrase = phrases[i];
+        QTreeWidgetItem* phraseItem = new QTreeWidgetItem();
+        phraseItem->setText(0, phrase.text);
+        phraseItem->setText(1, QString::number(phrase.occurrences.size()));
+        
+        for (const PhraseOccurrence& occurrence : phrase.occurrences) {
+            QTreeWidgetItem* item = new QTreeWidgetItem(phraseItem);
+            item->setText(0, QFileInfo(occurrence.chapterPath).baseName());
+            item->setData(0, PathRole, occurrence.chapterPath);
+            item->setData(0, PositionRole, occurrence.position);
+            item->setData(0, LengthRole, occurrence.length);
+        }
+        items.append(phraseItem);
+    }
+    m_phraseTree->addTopLevelItems(items);
+    
+    m_summaryLabel->setText(phrases.isEmpty() ? QString("No repeated phrases")
+                                              : QString("%1 repeated phrase(s)").arg(phrases.size()));
+}
+
+void RepeatedPhrasePanel::setDetecting(bool detecting)
+{
+    m_detectButton->setEnabled(!detecting);
+    if (detecting) {
+        m_summaryLabel->setText("Finding repeats...");
+    }
+}
+
+void RepeatedPhrasePanel::onItemActivated(QTreeWidgetItem* item, int column)
+{
+    Q_UNUSED(column)
+    
+    // Phrase rows just expand; occurrence rows jump
+    if (!item || !item->parent()) {
+        return;
+    }
+    
+    emit occurrenceActivated(item->data(0, PathRole).toString(),
+                             item->data(0, PositionRole).toInt(),
+                             item->data(0, LengthRole).toInt());
+}
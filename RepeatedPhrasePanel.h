@@ -0,0 +1,53 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef REPEATEDPHRASEPANEL_H
+#define REPEATEDPHRASEPANEL_H
+
+#include <QWidget>
+#include <QTreeWidget>
+#include <QLabel>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include "RepeatedPhraseDetector.h"
+
+// Lists phrases repeated close together; activating an occurrence jumps to it
+class RepeatedPhrasePanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit RepeatedPhrasePanel(QWidget *parent = nullptr);
+    ~RepeatedPhrasePanel();
+
+    void setPhrases(const QList<RepeatedPhrase>& phrases);
+    void setDetecting(bool detecting);
+
+signals:
+    void occurrenceActivated(const QString& chapterPath, int position, int length);
+    void detectRequested();
+
+private slots:
+    void onItemActivated(QTreeWidgetItem* item, int column);
+
+private:
+    void setupUI();
+
+    // Item data roles
+    static const int PathRole = Qt::UserRole;
+    static const int PositionRole = Qt::UserRole + 1;
+    static const int LengthRole = Qt::UserRole + 2;
+
+    // Constants
+    static const int MAX_PHRASES = 500;
+
+    QVBoxLayout* m_layout;
+    QLabel* m_summaryLabel;
+    QPushButton* m_detectButton;
+    QTreeWidget* m_phraseTree;
+};
+
+#endif // REPEATEDPHRASEPANEL_H
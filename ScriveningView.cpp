@@ -0,0 +1,335 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "ScriveningView.h"
+#include "EditorWidget.h"
+#include "DocumentRegistry.h"
+#include "ManuscriptPaginator.h"
+#include <QScrollBar>
+#include <QFileInfo>
+#include <QFontMetrics>
+#include <QResizeEvent>
+#include <QDebug>
+
+ScriveningView::ScriveningView(DocumentRegistry* registry, ManuscriptPaginator* paginator, QWidget *parent)
+    : QScrollArea(parent)
+    , m_registry(registry)
+    , m_paginator(paginator)
+    , m_content(new QWidget())
+    , m_contentLayout(nullptr)
+    , m_updateTimer(new QTimer(this))
+    , m_anchorIndex(-1)
+    , m_anchorOffset(0)
+    , m_restoringAnchor(false)
+{
+    m_contentLayout = new QVBoxLayout(m_content);
+    m_contentLayout->setContentsMargins(24, 12, 24, 12);
+    m_contentLayout->setSpacing(18);
+    m_contentLayout->addStretch();
+    
+    setWidget(m_content);
+    setWidgetResizable(true);
+    setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    m_content->installEventFilter(this);
+    
+    m_updateTimer->setSingleShot(true);
+    m_updateTimer->setInterval(UPDATE_DELAY_MS);
+    connect(m_updateTimer, &QTimer::timeout, this, &ScriveningView::updateLoadedSections);
+    connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &ScriveningView::onScrolled);
+}
+
+ScriveningView::~ScriveningView()
+{
+}
+
+void ScriveningView::setChapters(const QStringList& chapterPaths)
+{
+    unloadAll();
+    for (const Section& section : std::as_const(m_sections)) {
+        delete section.frame;
+    }
+    m_sections.clear();
+    m_anchorIndex = -1;
+    
+    for (const QString& chapterPath : chapterPaths) {
+        Section section;
+        section.chapterPath = chapterPath;
+        section.external = false;
+        section.measuredHeight = 0;
+        section.measuredWidth = 0;
+        
+        section.frame = new QWidget(m_content);
+        QVBoxLayout* frameLayout = new QVBoxLayout(section.frame);
+        frameLayout->setContentsMargins(0, 0, 0, 0);
+        frameLayout->setSpacing(4);
+        
+        section.header = new QLabel(section.frame);
+        section.header->setStyleSheet("QLabel { font-weight: bold; color: #555; border-bottom: 1px solid #ccc; padding-bottom: 2px; }");
+        frameLayout->addWidget(section.header);
+        
+        section.placeholder = new QWidget(section.frame);
+        frameLayout->addWidget(section.placeholder);
+        
+        updateHeader(section, false);
+        section.placeholder->setFixedHeight(estimateHeight(section));
+        m_contentLayout->insertWidget(m_contentLayout->count() - 1, section.frame);
+        m_sections.append(section);
+    }
+    
+    verticalScrollBar()->setValue(0);
+    scheduleUpdate();
+}
+
+QStringList ScriveningView::getChapters() const
+{
+    QStringList chapterPaths;
+    for (const Section& section : m_sections) {
+        chapterPaths.append(section.chapterPath);
+    }
+    
+    return chapterPaths;
+}
+
+void ScriveningView::scrollToChapter(const QString& chapterPath)
+{
+    for (int i = 0; i < m_sections.size(); ++i) {
+        if (m_sections[i].chapterPath == chapterPath) {
+            m_sections[i].external = false;
+            verticalScrollBar()->setValue(m_sections[i].frame->y());
+            m_anchorIndex = i;
+            m_anchorOffset = 0;
+            scheduleUpdate();
+            return;
+        }
+    }
+}
+
+void ScriveningView::setChapterModified(const QString& chapterPath, bool modified)
+{
+    for (Section& section : m_sections) {
+        if (section.chapterPath == chapterPath) {
+            updateHeader(section, modified);
+            return;
+        }
+    }
+}
+
+void ScriveningView::unloadAll()
+{
+    for (Section& section : m_sections) {
+        if (section.editor) {
+            unloadSection(section);
+        }
+    }
+}
+
+int ScriveningView::getLoadedCount() const
+{
+    int count = 0;
+    for (const Section& section : m_sections) {
+        if (section.editor) {
+            ++count;
+        }
+    }
+    
+    return count;
+}
+
+void ScriveningView::resizeEvent(QResizeEvent* event)
+{
+    QScrollArea::resizeEvent(event);
+    
+    if (event->size().width() != event->oldSize().width()) {
+        captureAnchor();
+        for (const Section& section : std::as_const(m_sections)) {
+            if (!section.editor) {
+                section.placeholder->setFixedHeight(estimateHeight(section));
+            }
+        }
+    }
+    scheduleUpdate();
+}
+
+bool ScriveningView::eventFilter(QObject* watched, QEvent* event)
+{
+    // Keep the anchored chapter still while sections above it change height
+    if (watched == m_content && event->type() == QEvent::Resize) {
+        restoreAnchor();
+    }
+    
+    return QScrollArea::eventFilter(watched, event);
+}
+
+void ScriveningView::onScrolled()
+{
+    // A user scroll replaces the anchor; our own corrections keep it
+    if (!m_restoringAnchor) {
+        m_anchorIndex = -1;
+    }
+    scheduleUpdate();
+}
+
+void ScriveningView::scheduleUpdate()
+{
+    m_updateTimer->start();
+}
+
+void ScriveningView::updateLoadedSections()
+{
+    if (m_sections.isEmpty()) {
+        return;
+    }
+    
+    const int top = verticalScrollBar()->value();
+    const int screen = viewport()->height();
+    const int loadTop = top - screen * LOAD_MARGIN_SCREENS;
+    const int loadBottom = top + screen * (1 + LOAD_MARGIN_SCREENS);
+    const int keepTop = top - screen * UNLOAD_MARGIN_SCREENS;
+    const int keepBottom = top + screen * (1 + UNLOAD_MARGIN_SCREENS);
+    
+    if (m_anchorIndex < 0) {
+        captureAnchor();
+    }
+    
+    // Unload first so memory stays bounded while scrolling far
+    for (Section& section : m_sections) {
+        QRect geometry = section.frame->geometry();
+        if (section.editor && (geometry.bottom() < keepTop || geometry.top() > keepBottom)) {
+            unloadSection(section);
+        }
+    }
+    
+    bool loaded = false;
+    for (Section& section : m_sections) {
+        QRect geometry = section.frame->geometry();
+        if (!section.editor && !section.external && geometry.bottom() >= loadTop && geometry.top() <= loadBottom) {
+            loadSection(section);
+            loaded = true;
+        }
+    }
+    
+    // Real heights may have pulled more chapters into range
+    if (loaded) {
+        scheduleUpdate();
+    }
+}
+
+void ScriveningView::captureAnchor()
+{
+    const int top = verticalScrollBar()->value();
+    for (int i = 0; i < m_sections.size(); ++i) {
+        QRect geometry = m_sections[i].frame->geometry();
+        if (geometry.bottom() >= top) {
+            m_anchorIndex = i;
+            m_anchorOffset = geometry.top() - top;
+            return;
+        }
+    }
+    
+    m_anchorIndex = -1;
+}
+
+void ScriveningView::restoreAnchor()
+{
+    if (m_anchorIndex < 0 || m_anchorIndex >= m_sections.size()) {
+        return;
+    }
+    
+    m_restoringAnchor = true;
+    verticalScrollBar()->setValue(m_sections[m_anchorIndex].frame->y() - m_anchorOffset);
+    m_restoringAnchor = false;
+}
+
+void ScriveningView::loadSection(Section& section)
+{
+    EditorWidget* editor = m_registry ? m_registry->editorForPath(section.chapterPath) : nullptr;
+    
+    if (editor) {
+        // One editor per file: take over the open one instead of loading a copy
+        if (m_registry->containerForEditor(editor) != this) {
+            emit editorAdoptionRequested(editor);
+        }
+        if (m_registry->containerForEditor(editor) != this) {
+            section.external = true;
+            section.header->setText(section.header->text() + " (open in another window)");
+            return;
+        }
+    } else {
+        editor = new EditorWidget(section.frame);
+        if (!editor->loadFromFile(section.chapterPath)) {
+            qDebug() << "Cannot load chapter into scrivenings:" << section.chapterPath;
+            delete editor;
+            section.external = true;
+            return;
+        }
+        emit editorLoaded(editor, section.chapterPath);
+    }
+    
+    editor->setParent(section.frame);
+    editor->setEmbedded(true);
+    section.frame->layout()->addWidget(editor);
+    section.placeholder->hide();
+    editor->show();
+    section.editor = editor;
+    
+    const QString chapterPath = section.chapterPath;
+    connect(editor, &EditorWidget::cursorRectChanged, this, [this, editor](const QRect& rect) {
+        QPoint center = editor->mapTo(m_content, rect.center());
+        ensureVisible(center.x(), center.y(), 0, rect.height());
+    });
+    connect(editor, &QObject::destroyed, this, [this, chapterPath]() {
+        // Closed from elsewhere (e.g. the chapter was deleted)
+        for (Section& other : m_sections) {
+            if (other.chapterPath == chapterPath && !other.editor) {
+                other.placeholder->setFixedHeight(estimateHeight(other));
+                other.placeholder->show();
+            }
+        }
+    });
+}
+
+void ScriveningView::unloadSection(Section& section)
+{
+    EditorWidget* editor = section.editor;
+    section.editor = nullptr;
+    
+    // Remembered so the placeholder keeps the chapter's real height
+    section.measuredHeight = editor->height();
+    section.measuredWidth = viewport()->width();
+    section.placeholder->setFixedHeight(section.measuredHeight);
+    section.placeholder->show();
+    
+    disconnect(editor, nullptr, this, nullptr);
+    emit editorUnloading(editor);
+    editor->hide();
+    editor->deleteLater();
+}
+
+int ScriveningView::estimateHeight(const Section& section) const
+{
+    const int width = viewport()->width() - m_contentLayout->contentsMargins().left() -
+                      m_contentLayout->contentsMargins().right();
+    if (section.measuredHeight > 0 && section.measuredWidth == viewport()->width()) {
+        return section.measuredHeight;
+    }
+    
+    // Manuscript line counts are cached by the paginator; file size is the fallback
+    QFontMetrics metrics(font());
+    int charsPerLine = qMax(20, width / qMax(1, metrics.averageCharWidth()));
+    int manuscriptLines = m_paginator ? m_paginator->getLineCount(section.chapterPath) : -1;
+    qint64 characters = manuscriptLines >= 0
+        ? static_cast<qint64>(manuscriptLines) * MANUSCRIPT_CHARS_PER_LINE
+        : QFileInfo(section.chapterPath).size();
+    
+    qint64 lines = characters / charsPerLine + 1;
+    return static_cast<int>(qBound<qint64>(2, lines, 1000000) * metrics.lineSpacing());
+}
+
+void ScriveningView::updateHeader(Section& section, bool modified)
+{
+    QString title = QFileInfo(section.chapterPath).baseName().replace('_', ' ');
+    section.header->setText(modified ? title + " •" : title);
+}
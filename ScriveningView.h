@@ -0,0 +1,93 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef SCRIVENINGVIEW_H
+#define SCRIVENINGVIEW_H
+
+#include <QScrollArea>
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QLabel>
+#include <QPointer>
+#include <QVBoxLayout>
+#include <QTimer>
+
+class EditorWidget;
+class DocumentRegistry;
+class ManuscriptPaginator;
+
+// Continuous view of the whole manuscript, one embedded EditorWidget per
+// chapter. Only chapters within a screen of the viewport are loaded; the
+// rest are placeholders sized from cached pagination stats, and chapters
+// far out of view are saved and unloaded again. Loaded editors are tracked
+// like tabs, so edits go to their own file and auto-save entry.
+class ScriveningView : public QScrollArea
+{
+    Q_OBJECT
+
+public:
+    explicit ScriveningView(DocumentRegistry* registry, ManuscriptPaginator* paginator, QWidget *parent = nullptr);
+    ~ScriveningView();
+
+    void setChapters(const QStringList& chapterPaths);
+    QStringList getChapters() const;
+    void scrollToChapter(const QString& chapterPath);
+    void setChapterModified(const QString& chapterPath, bool modified);
+    void unloadAll();
+    int getLoadedCount() const;
+
+    // Constants
+    static const int LOAD_MARGIN_SCREENS = 1;
+    static const int UNLOAD_MARGIN_SCREENS = 3;
+    static const int UPDATE_DELAY_MS = 50;
+    static const int MANUSCRIPT_CHARS_PER_LINE = 60;
+
+signals:
+    void editorLoaded(EditorWidget* editor, const QString& chapterPath);   // New editor; track it
+    void editorAdoptionRequested(EditorWidget* editor);   // Open elsewhere; hand it to this view
+    void editorUnloading(EditorWidget* editor);           // Save and untrack; deleted afterwards
+
+protected:
+    void resizeEvent(QResizeEvent* event) override;
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private slots:
+    void scheduleUpdate();
+    void updateLoadedSections();
+    void onScrolled();
+
+private:
+    struct Section {
+        QString chapterPath;
+        QWidget* frame;
+        QLabel* header;
+        QWidget* placeholder;
+        QPointer<EditorWidget> editor;   // Null while unloaded
+        bool external;                   // Open in a detached window; left there
+        int measuredHeight;              // Editor height when last unloaded
+        int measuredWidth;
+    };
+
+    void loadSection(Section& section);
+    void unloadSection(Section& section);
+    int estimateHeight(const Section& section) const;
+    void updateHeader(Section& section, bool modified);
+    void captureAnchor();
+    void restoreAnchor();
+
+    DocumentRegistry* m_registry;       // Not owned
+    ManuscriptPaginator* m_paginator;   // Not owned; supplies line counts
+    QWidget* m_content;
+    QVBoxLayout* m_contentLayout;
+    QList<Section> m_sections;
+    QTimer* m_updateTimer;
+    int m_anchorIndex;      // Section kept still while heights above it change
+    int m_anchorOffset;
+    bool m_restoringAnchor;
+};
+
+#endif // SCRIVENINGVIEW_H
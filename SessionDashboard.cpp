@@ -0,0 +1,155 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "SessionDashboard.h"
+#include <QHeaderView>
+#include <QSettings>
+#include <QLocale>
+
+namespace {
+
+QString wordsPerMinute(int words, qint64 activeMs)
+{
+    if (activeMs < 60000 || words <= 0) {
+        return QString("-");
+    }
+    return QString::number(words / (activeMs / 60000.0), 'f', 1);
+}
+
+}
+
+SessionDashboard::SessionDashboard(QWidget *parent)
+    : QWidget(parent)
+    , m_layout(nullptr)
+    , m_summaryLayout(nullptr)
+    , m_goalSpin(nullptr)
+    , m_todayLabel(nullptr)
+    , m_weekLabel(nullptr)
+    , m_streakLabel(nullptr)
+    , m_bestStreakLabel(nullptr)
+    , m_speedLabel(nullptr)
+    , m_refreshButton(nullptr)
+    , m_dayTree(nullptr)
+{
+    setupUI();
+    updateSummary();
+}
+
+SessionDashboard::~SessionDashboard()
+{
+}
+
+void SessionDashboard::setupUI()
+{
+    m_layout = new QVBoxLayout(this);
+    m_layout->setContentsMargins(4, 4, 4, 4);
+    
+    m_summaryLayout = new QFormLayout();
+    m_goalSpin = new QSpinBox(this);
+    m_goalSpin->setRange(50, 20000);
+    m_goalSpin->setSingleStep(50);
+    m_goalSpin->setSuffix(" words");
+    m_goalSpin->setValue(QSettings().value("Sessions/dailyGoal", DEFAULT_DAILY_GOAL).toInt());
+    m_todayLabel = new QLabel(this);
+    m_weekLabel = new QLabel(this);
+    m_streakLabel = new QLabel(this);
+    m_bestStreakLabel = new QLabel(this);
+    m_speedLabel = new QLabel(this);
+    m_speedLabel->setToolTip("Net words per minute of active typing over the last 30 days");
+    
+    m_summaryLayout->addRow("Daily goal:", m_goalSpin);
+    m_summaryLayout->addRow("Today:", m_todayLabel);
+    m_summaryLayout->addRow("Last 7 days:", m_weekLabel);
+    m_summaryLayout->addRow("Streak:", m_streakLabel);
+    m_summaryLayout->addRow("Best streak:", m_bestStreakLabel);
+    m_summaryLayout->addRow("Speed:", m_speedLabel);
+    m_layout->addLayout(m_summaryLayout);
+    
+    m_refreshButton = new QPushButton("Refresh", this);
+    m_layout->addWidget(m_refreshButton);
+    
+    m_dayTree = new QTreeWidget(this);
+    m_dayTree->setHeaderLabels({"Day", "Words", "Minutes", "Words/min"});
+    m_dayTree->setRootIsDecorated(false);
+    m_dayTree->header()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    m_layout->addWidget(m_dayTree);
+    
+    connect(m_goalSpin, &QSpinBox::valueChanged, this, &SessionDashboard::onGoalChanged);
+    connect(m_refreshButton, &QPushButton::clicked, this, &SessionDashboard::refreshRequested);
+}
+
+void SessionDashboard::setHistory(const QList<SessionDay>& days)
+{
+    m_days = days;
+    
+    m_dayTree->clear();
+    QList<QTreeWidgetItem*> items;
+    for (qsizetype i = m_days.size() - 1; i >= 0 && items.size() < RECENT_DAYS; --i) {
+        const SessionDay& day = m_days[i];
+        QTreeWidgetItem* item = new QTreeWidgetItem();
+        item->setText(0, QLocale().toString(day.date, QLocale::ShortFormat));
+        item->setText(1, QString::number(day.words));
+        item->setText(2, QString::number(day.activeMs / 60000));
+        item->setText(3, wordsPerMinute(day.words, day.activeMs));
+        item->setTextAlignment(1, Qt::AlignRight);
+        item->setTextAlignment(2, Qt::AlignRight);
+        item->setTextAlignment(3, Qt::AlignRight);
+        items.append(item);
+    }
+    m_dayTree->addTopLevelItems(items);
+    
+    updateSummary();
+}
+
+void SessionDashboard::onGoalChanged(int goal)
+{
+    QSettings().setValue("Sessions/dailyGoal", goal);
+    updateSummary();
+}
+
+void SessionDashboard::updateSummary()
+{
+    const int goal = m_goalSpin->value();
+    
+    int today = 0;
+    int week = 0;
+    int recentWords = 0;
+    qint64 recentMs = 0;
+    int run = 0;
+    int bestStreak = 0;
+    for (qsizetype i = 0; i < m_days.size(); ++i) {
+        const SessionDay& day = m_days[i];
+        const qsizetype age = m_days.size() - 1 - i;
+        
+        run = day.words >= goal ? run + 1 : 0;
+        bestStreak = qMax(bestStreak, run);
+        
+        if (age == 0) {
+            today = day.words;
+        }
+        if (age < 7) {
+            week += day.words;
+        }
+        if (age < RECENT_DAYS) {
+            recentWords += day.words;
+            recentMs += day.activeMs;
+        }
+    }
+    
+    // Today still counts toward a streak that was alive yesterday
+    int streak = run;
+    if (streak == 0 && m_days.size() >= 2) {
+        for (qsizetype i = m_days.size() - 2; i >= 0 && m_days[i].words >= goal; --i) {
+            ++streak;
+        }
+    }
+    
+    m_todayLabel->setText(QString("%1 / %2").arg(today).arg(goal));
+    m_weekLabel->setText(QString::number(week));
+    m_streakLabel->setText(QString("%1 days").arg(streak));
+    m_bestStreakLabel->setText(QString("%1 days").arg(bestStreak));
+    m_speedLabel->setText(wordsPerMinute(recentWords, recentMs));
+}
@@ -0,0 +1,59 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef SESSIONDASHBOARD_H
+#define SESSIONDASHBOARD_H
+
+#include <QWidget>
+#include <QTreeWidget>
+#include <QSpinBox>
+#include <QLabel>
+#include <QPushButton>
+#include <QFormLayout>
+#include <QVBoxLayout>
+#include <QList>
+#include "SessionLog.h"
+
+// Daily goal, streaks and writing speed from the project's session log
+class SessionDashboard : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit SessionDashboard(QWidget *parent = nullptr);
+    ~SessionDashboard();
+
+    void setHistory(const QList<SessionDay>& days);   // Oldest first, ending today
+
+    // Constants
+    static const int HISTORY_DAYS = 365;
+    static const int RECENT_DAYS = 30;
+    static const int DEFAULT_DAILY_GOAL = 500;
+
+signals:
+    void refreshRequested();
+
+private slots:
+    void onGoalChanged(int goal);
+
+private:
+    void setupUI();
+    void updateSummary();
+
+    QVBoxLayout* m_layout;
+    QFormLayout* m_summaryLayout;
+    QSpinBox* m_goalSpin;
+    QLabel* m_todayLabel;
+    QLabel* m_weekLabel;
+    QLabel* m_streakLabel;
+    QLabel* m_bestStreakLabel;
+    QLabel* m_speedLabel;
+    QPushButton* m_refreshButton;
+    QTreeWidget* m_dayTree;
+    QList<SessionDay> m_days;
+};
+
+#endif // SESSIONDASHBOARD_H
@@ -0,0 +1,151 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "SessionLog.h"
+#include <QFile>
+#include <QByteArray>
+#include <QDateTime>
+#include <QtEndian>
+#include <QDebug>
+#include <cstring>
+
+namespace {
+
+const char LOG_MAGIC[4] = {'N', 'D', 'T', 'S'};
+
+quint32 readMinute(const uchar* record)
+{
+    return qFromLittleEndian<quint32>(record);
+}
+
+quint32 minuteOf(const QDate& date)
+{
+    return static_cast<quint32>(date.startOfDay().toSecsSinceEpoch() / 60);
+}
+
+}
+
+SessionLog::SessionLog(const QString& filePath)
+    : m_filePath(filePath)
+{
+}
+
+bool SessionLog::append(const QList<SessionRecord>& records)
+{
+    if (records.isEmpty()) {
+        return true;
+    }
+    
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::ReadWrite)) {
+        qDebug() << "Cannot open session log:" << m_filePath << file.errorString();
+        return false;
+    }
+    
+    if (file.size() < HEADER_SIZE) {
+        QByteArray header(LOG_MAGIC, 4);
+        header.resize(HEADER_SIZE);
+        qToLittleEndian<quint32>(FORMAT_VERSION, header.data() + 4);
+        file.resize(0);
+        file.write(header);
+    } else if ((file.size() - HEADER_SIZE) % RECORD_SIZE != 0) {
+        // A torn write from a crash; drop the partial record to keep alignment
+        file.resize(file.size() - (file.size() - HEADER_SIZE) % RECORD_SIZE);
+    }
+    
+    QByteArray data(records.size() * RECORD_SIZE, Qt::Uninitialized);
+    uchar* out = reinterpret_cast<uchar*>(data.data());
+    for (const SessionRecord& record : records) {
+        qToLittleEndian<quint32>(record.minute, out);
+        qToLittleEndian<quint32>(record.chapterKey, out + 4);
+        qToLittleEndian<qint32>(record.wordDelta, out + 8);
+        qToLittleEndian<quint32>(record.activeMs, out + 12);
+        out += RECORD_SIZE;
+    }
+    
+    file.seek(file.size());
+    if (file.write(data) != data.size()) {
+        qDebug() << "Failed to append to session log:" << file.errorString();
+        return false;
+    }
+    
+    return true;
+}
+
+QList<SessionDay> SessionLog::getDailyTotals(const QDate& from, const QDate& to) const
+{
+    QList<SessionDay> days;
+    if (!from.isValid() || !to.isValid() || from > to) {
+        return days;
+    }
+    
+    days.reserve(from.daysTo(to) + 1);
+    QList<quint32> dayStarts;   // Parallel to days, plus the end of the range
+    dayStarts.reserve(days.capacity() + 1);
+    for (QDate date = from; date <= to; date = date.addDays(1)) {
+        SessionDay day;
+        day.date = date;
+        days.append(day);
+        dayStarts.append(minuteOf(date));
+    }
+    dayStarts.append(minuteOf(to.addDays(1)));
+    
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::ReadOnly) || file.size() < HEADER_SIZE + RECORD_SIZE) {
+        return days;
+    }
+    
+    uchar* data = file.map(0, file.size());
+    if (!data || std::memcmp(data, LOG_MAGIC, 4) != 0) {
+        return days;
+    }
+    
+    const uchar* records = data + HEADER_SIZE;
+    const qint64 count = (file.size() - HEADER_SIZE) / RECORD_SIZE;
+    
+    // Records are in time order, so the range starts at a binary-searched index
+    qint64 low = 0;
+    qint64 high = count;
+    while (low < high) {
+        qint64 middle = low + (high - low) / 2;
+        if (readMinute(records + middle * RECORD_SIZE) < dayStarts.first()) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    
+    int dayIndex = 0;
+    for (qint64 i = low; i < count; ++i) {
+        const uchar* record = records + i * RECORD_SIZE;
+        quint32 minute = readMinute(record);
+        if (minute >= dayStarts.last()) {
+            break;
+        }
+        while (minute >= dayStarts[dayIndex + 1]) {
+            ++dayIndex;
+        }
+        
+        days[dayIndex].words += qFromLittleEndian<qint32>(record + 8);
+        days[dayIndex].activeMs += qFromLittleEndian<quint32>(record + 12);
+    }
+    
+    file.unmap(data);
+    return days;
+}
+
+quint32 SessionLog::chapterKey(const QString& chapterId)
+{
+    // FNV-1a over UTF-8: stable across runs and Qt versions, unlike qHash
+    quint32 hash = 2166136261u;
+    const QByteArray bytes = chapterId.toUtf8();
+    for (char byte : bytes) {
+        hash ^= static_cast<uchar>(byte);
+        hash *= 16777619u;
+    }
+    
+    return hash;
+}
@@ -0,0 +1,51 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef SESSIONLOG_H
+#define SESSIONLOG_H
+
+#include <QString>
+#include <QList>
+#include <QDate>
+#include <QtGlobal>
+
+struct SessionRecord {
+    quint32 minute;       // Minutes since the Unix epoch, never decreasing in a log
+    quint32 chapterKey;   // SessionLog::chapterKey() of the stable chapter ID
+    qint32 wordDelta;     // Net words added during the minute
+    quint32 activeMs;     // Typing time, idle gaps excluded
+};
+
+struct SessionDay {
+    QDate date;
+    int words = 0;
+    qint64 activeMs = 0;
+};
+
+// Append-only writing history. The file is an 8-byte header followed by
+// fixed 16-byte little-endian records in time order, so queries memory-map
+// it, binary-search to the first wanted minute and stream from there.
+class SessionLog
+{
+public:
+    explicit SessionLog(const QString& filePath);
+
+    QString getFilePath() const { return m_filePath; }
+    bool append(const QList<SessionRecord>& records);
+    QList<SessionDay> getDailyTotals(const QDate& from, const QDate& to) const;   // One entry per day, local time
+
+    static quint32 chapterKey(const QString& chapterId);
+
+    // Constants
+    static const int HEADER_SIZE = 8;
+    static const int RECORD_SIZE = 16;
+    static const quint32 FORMAT_VERSION = 1;
+
+private:
+    QString m_filePath;
+};
+
+#endif // SESSIONLOG_H
@@ -0,0 +1,176 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "SessionRecorder.h"
+#include "EditorWidget.h"
+#include <QDateTime>
+#include <QDebug>
+
+SessionRecorder::SessionRecorder(QObject *parent)
+    : QObject(parent)
+    , m_currentMinute(0)
+    , m_flushTimer(new CoalescedTimer(this))
+{
+    m_flushTimer->setInterval(FLUSH_INTERVAL_MS);
+    m_flushTimer->setTimerType(Qt::VeryCoarseTimer);
+    connect(m_flushTimer, &CoalescedTimer::timeout, this, &SessionRecorder::onFlushTimer);
+}
+
+SessionRecorder::~SessionRecorder()
+{
+    flush();
+}
+
+void SessionRecorder::setLogPath(const QString& filePath)
+{
+    if (m_log && m_log->getFilePath() == filePath) {
+        return;
+    }
+    
+    // Whatever was typed so far belongs to the previous project
+    flush();
+    m_pending.clear();
+    
+    if (filePath.isEmpty()) {
+        m_log.reset();
+        m_flushTimer->stop();
+    } else {
+        m_log = std::make_unique<SessionLog>(filePath);
+        m_flushTimer->start();
+    }
+    
+    emit historyChanged();
+}
+
+void SessionRecorder::trackEditor(EditorWidget* editor, const QString& chapterId)
+{
+    if (!editor) {
+        return;
+    }
+    
+    EditorState state;
+    state.chapterKey = SessionLog::chapterKey(chapterId);
+    state.lastWordCount = editor->getWordCount();
+    state.edited = false;
+    state.lastActivityMs = 0;
+    
+    if (!m_editors.contains(editor)) {
+        connect(editor, &EditorWidget::contentChanged, this, &SessionRecorder::onContentChanged);
+        connect(editor, &EditorWidget::wordCountChanged, this, &SessionRecorder::onWordCountChanged);
+        connect(editor, &QObject::destroyed, this, &SessionRecorder::onEditorDestroyed);
+    }
+    m_editors.insert(editor, state);
+}
+
+void SessionRecorder::onContentChanged()
+{
+    auto it = m_editors.find(sender());
+    if (it == m_editors.end()) {
+        return;
+    }
+    
+    // Time between keystrokes counts as writing unless the gap looks like a break
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+    qint64 gap = now - it->lastActivityMs;
+    it->lastActivityMs = now;
+    it->edited = true;
+    
+    if (gap > 0 && gap <= IDLE_GAP_MS) {
+        record(it->chapterKey, 0, gap);
+    }
+}
+
+void SessionRecorder::onWordCountChanged(int wordCount)
+{
+    auto it = m_editors.find(sender());
+    if (it == m_editors.end()) {
+        return;
+    }
+    
+    // Counts after a reload or file switch move the baseline, not the tally
+    int delta = wordCount - it->lastWordCount;
+    it->lastWordCount = wordCount;
+    if (it->edited && delta != 0) {
+        record(it->chapterKey, delta, 0);
+    }
+    it->edited = false;
+}
+
+void SessionRecorder::onEditorDestroyed(QObject* editor)
+{
+    m_editors.remove(editor);
+}
+
+void SessionRecorder::record(quint32 chapterKey, int wordDelta, qint64 activeMs)
+{
+    if (!m_log) {
+        return;
+    }
+    
+    // Clamped so a clock step backwards can't break the log's time order
+    quint32 minute = qMax(m_currentMinute, static_cast<quint32>(QDateTime::currentSecsSinceEpoch() / 60));
+    if (minute != m_currentMinute) {
+        closeMinute();
+        m_currentMinute = minute;
+    }
+    
+    auto it = m_openMinute.find(chapterKey);
+    if (it == m_openMinute.end()) {
+        it = m_openMinute.insert(chapterKey, {minute, chapterKey, 0, 0});
+    }
+    it->wordDelta += wordDelta;
+    it->activeMs += static_cast<quint32>(activeMs);
+}
+
+void SessionRecorder::closeMinute()
+{
+    for (const SessionRecord& record : std::as_const(m_openMinute)) {
+        m_pending.append(record);
+    }
+    m_openMinute.clear();
+}
+
+bool SessionRecorder::writePending()
+{
+    if (!m_log || m_pending.isEmpty()) {
+        return false;
+    }
+    
+    if (!m_log->append(m_pending)) {
+        return false;   // Kept for the next attempt
+    }
+    
+    m_pending.clear();
+    return true;
+}
+
+void SessionRecorder::flush()
+{
+    closeMinute();
+    writePending();
+}
+
+void SessionRecorder::onFlushTimer()
+{
+    // Only finished minutes are written; the open one may still grow
+    if (static_cast<quint32>(QDateTime::currentSecsSinceEpoch() / 60) > m_currentMinute) {
+        closeMinute();
+    }
+    
+    if (writePending()) {
+        emit historyChanged();
+    }
+}
+
+QList<SessionDay> SessionRecorder::getDailyTotals(const QDate& from, const QDate& to)
+{
+    if (!m_log) {
+        return QList<SessionDay>();
+    }
+    
+    flush();
+    return m_log->getDailyTotals(from, to);
+}
@@ -0,0 +1,72 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef SESSIONRECORDER_H
+#define SESSIONRECORDER_H
+
+#include <QObject>
+#include <QString>
+#include <QHash>
+#include <QMap>
+#include <QList>
+#include <memory>
+#include "SessionLog.h"
+#include "TickService.h"
+
+class EditorWidget;
+
+// Turns editor activity into per-chapter, per-minute SessionRecords. Only
+// the current minute is held in memory; closed minutes are appended to the
+// project's session log once a minute and whenever the project changes.
+class SessionRecorder : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SessionRecorder(QObject *parent = nullptr);
+    ~SessionRecorder();
+
+    void setLogPath(const QString& filePath);   // Empty stops recording
+    void trackEditor(EditorWidget* editor, const QString& chapterId);
+    void flush();
+
+    // History, including the minute still being recorded
+    QList<SessionDay> getDailyTotals(const QDate& from, const QDate& to);
+
+    // Constants
+    static const int FLUSH_INTERVAL_MS = 60000;
+    static const int IDLE_GAP_MS = 30000;   // Longer pauses don't count as writing time
+
+signals:
+    void historyChanged();
+
+private slots:
+    void onContentChanged();
+    void onWordCountChanged(int wordCount);
+    void onEditorDestroyed(QObject* editor);
+    void onFlushTimer();
+
+private:
+    struct EditorState {
+        quint32 chapterKey;
+        int lastWordCount;
+        bool edited;              // Typed since lastWordCount was taken
+        qint64 lastActivityMs;
+    };
+
+    void record(quint32 chapterKey, int wordDelta, qint64 activeMs);
+    void closeMinute();
+    bool writePending();
+
+    std::unique_ptr<SessionLog> m_log;
+    QHash<QObject*, EditorState> m_editors;
+    QMap<quint32, SessionRecord> m_openMinute;   // Chapter key -> record for m_currentMinute
+    quint32 m_currentMinute;
+    QList<SessionRecord> m_pending;              // Closed minutes not yet written
+    CoalescedTimer* m_flushTimer;
+};
+
+#endif // SESSIONRECORDER_H
@@ -0,0 +1,74 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "StatisticsPanel.h"
+
+StatisticsPanel::StatisticsPanel(QWidget *parent)
+    : QWidget(parent)
+    , m_layout(nullptr)
+    , m_titleLabel(nullptr)
+    , m_wordsLabel(nullptr)
+    , m_sentencesLabel(nullptr)
+    , m_averageLabel(nullptr)
+    , m_paragraphsLabel(nullptr)
+    , m_readingEaseLabel(nullptr)
+    , m_gradeLabel(nullptr)
+    , m_dialogueLabel(nullptr)
+{
+    setupUI();
+    clear();
+}
+
+StatisticsPanel::~StatisticsPanel()
+{
+}
+
+void StatisticsPanel::setupUI()
+{
+    m_layout = new QFormLayout(this);
+    m_layout->setContentsMargins(8, 8, 8, 8);
+    
+    m_titleLabel = new QLabel(this);
+    m_titleLabel->setStyleSheet("QLabel { font-weight: bold; }");
+    m_wordsLabel = new QLabel(this);
+    m_sentencesLabel = new QLabel(this);
+    m_averageLabel = new QLabel(this);
+    m_paragraphsLabel = new QLabel(this);
+    m_readingEaseLabel = new QLabel(this);
+    m_gradeLabel = new QLabel(this);
+    m_dialogueLabel = new QLabel(this);
+    
+    m_readingEaseLabel->setToolTip("Flesch reading ease: higher is easier; 60-70 is plain English");
+    m_gradeLabel->setToolTip("Flesch-Kincaid grade level: approximate US school grade");
+    
+    m_layout->addRow(m_titleLabel);
+    m_layout->addRow("Words:", m_wordsLabel);
+    m_layout->addRow("Sentences:", m_sentencesLabel);
+    m_layout->addRow("Avg. sentence:", m_averageLabel);
+    m_layout->addRow("Paragraphs:", m_paragraphsLabel);
+    m_layout->addRow("Reading ease:", m_readingEaseLabel);
+    m_layout->addRow("Grade level:", m_gradeLabel);
+    m_layout->addRow("Dialogue:", m_dialogueLabel);
+}
+
+void StatisticsPanel::setStatistics(const QString& title, const DocumentStatistics& statistics)
+{
+    const bool hasSentences = statistics.totals.sentences > 0;
+    
+    m_titleLabel->setText(title);
+    m_wordsLabel->setText(QString::number(statistics.totals.words));
+    m_sentencesLabel->setText(QString::number(statistics.totals.sentences));
+    m_averageLabel->setText(QString("%1 words").arg(QString::number(statistics.averageSentenceLength(), 'f', 1)));
+    m_paragraphsLabel->setText(QString::number(statistics.paragraphs));
+    m_readingEaseLabel->setText(hasSentences ? QString::number(statistics.fleschReadingEase(), 'f', 1) : QString("-"));
+    m_gradeLabel->setText(hasSentences ? QString::number(statistics.fleschKincaidGrade(), 'f', 1) : QString("-"));
+    m_dialogueLabel->setText(QString("%1%").arg(QString::number(statistics.dialogueRatio() * 100.0, 'f', 0)));
+}
+
+void StatisticsPanel::clear()
+{
+    setStatistics("No document", DocumentStatistics());
+}
@@ -0,0 +1,41 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef STATISTICSPANEL_H
+#define STATISTICSPANEL_H
+
+#include <QWidget>
+#include <QLabel>
+#include <QFormLayout>
+#include "TextStatistics.h"
+
+// Sentence and readability statistics for the active editor
+class StatisticsPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit StatisticsPanel(QWidget *parent = nullptr);
+    ~StatisticsPanel();
+
+    void setStatistics(const QString& title, const DocumentStatistics& statistics);
+    void clear();
+
+private:
+    void setupUI();
+
+    QFormLayout* m_layout;
+    QLabel* m_titleLabel;
+    QLabel* m_wordsLabel;
+    QLabel* m_sentencesLabel;
+    QLabel* m_averageLabel;
+    QLabel* m_paragraphsLabel;
+    QLabel* m_readingEaseLabel;
+    QLabel* m_gradeLabel;
+    QLabel* m_dialogueLabel;
+};
+
+#endif // STATISTICSPANEL_H
@@ -0,0 +1,228 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "StyleLinter.h"
+#include "TaskScheduler.h"
+#include <QTextDocument>
+#include <QTextBlock>
+#include <QSet>
+#include <QDebug>
+
+StyleLinter::StyleLinter(QTextDocument* document, QObject *parent)
+    : QObject(parent)
+    , m_document(document)
+    , m_lintTimer(new CoalescedTimer(this))
+    , m_watcher(nullptr)
+    , m_generation(0)
+    , m_runningGeneration(0)
+    , m_lintQueued(false)
+    , m_paused(false)
+{
+    m_lintTimer->setSingleShot(true);
+    m_lintTimer->setInterval(LINT_DELAY_MS);
+    connect(m_lintTimer, &CoalescedTimer::timeout, this, &StyleLinter::startLint);
+    connect(m_document, &QTextDocument::contentsChange, this, &StyleLinter::onContentsChange);
+}
+
+StyleLinter::~StyleLinter()
+{
+    if (m_watcher) {
+        m_watcher->cancel();
+        m_watcher->waitForFinished();
+    }
+}
+
+void StyleLinter::setRuleSet(std::shared_ptr<const StyleRuleSet> ruleSet)
+{
+    // Results still in flight belong to the old rules and will be dropped
+    m_ruleSet = std::move(ruleSet);
+    ++m_generation;
+    
+    m_marks.clear();
+    emit marksChanged(m_marks);
+    
+    if (m_ruleSet) {
+        rescan();
+    } else {
+        m_lintTimer->stop();
+        m_dirtyStart = QTextCursor();
+        m_dirtyEnd = QTextCursor();
+    }
+}
+
+void StyleLinter::setPaused(bool paused)
+{
+    if (m_paused == paused) {
+        return;
+    }
+    m_paused = paused;
+    
+    if (!m_paused && !m_dirtyStart.isNull() && !m_watcher) {
+        m_lintTimer->start();
+    }
+}
+
+void StyleLinter::rescan()
+{
+    if (!m_ruleSet) {
+        return;
+    }
+    
+    markDirty(0, m_document->characterCount() - 1);
+    m_lintTimer->start();
+}
+
+void StyleLinter::onContentsChange(int position, int charsRemoved, int charsAdded)
+{
+    Q_UNUSED(charsRemoved);
+    
+    if (!m_ruleSet) {
+        return;
+    }
+    
+    markDirty(position, position + charsAdded);
+    m_lintTimer->start();
+}
+
+void StyleLinter::markDirty(int from, int to)
+{
+    int documentEnd = qMax(0, m_document->characterCount() - 1);
+    from = qBound(0, from, documentEnd);
+    to = qBound(from, to, documentEnd);
+    
+    // Cursors keep the span in place while further edits shift the text
+    if (m_dirtyStart.isNull()) {
+        m_dirtyStart = QTextCursor(m_document);
+        m_dirtyStart.setPosition(from);
+        m_dirtyEnd = QTextCursor(m_document);
+        m_dirtyEnd.setPosition(to);
+        return;
+    }
+    
+    if (from < m_dirtyStart.position()) {
+        m_dirtyStart.setPosition(from);
+    }
+    if (to > m_dirtyEnd.position()) {
+        m_dirtyEnd.setPosition(to);
+    }
+}
+
+void StyleLinter::startLint()
+{
+    if (!m_ruleSet || m_dirtyStart.isNull() || m_paused) {
+        return;
+    }
+    
+    if (m_watcher) {
+        m_lintQueued = true;
+        return;
+    }
+    
+    // Only the dirty blocks are copied; the GUI thread never runs the rules
+    QTextBlock block = m_document->findBlock(m_dirtyStart.position());
+    QTextBlock last = m_document->findBlock(m_dirtyEnd.position());
+    m_dirtyStart = QTextCursor();
+    m_dirtyEnd = QTextCursor();
+    
+    m_pending.clear();
+    m_pendingBlocks.clear();
+    while (block.isValid()) {
+        m_pending.append({block.text(), block.revision()});
+        m_pendingBlocks.append(QTextCursor(block));
+        if (block == last) {
+            break;
+        }
+        block = block.next();
+    }
+    
+    m_runningGeneration = m_generation;
+    m_watcher = new QFutureWatcher<QList<QList<StyleIssue>>>(this);
+    connect(m_watcher, &QFutureWatcherBase::finished, this, &StyleLinter::onLintFinished);
+    m_watcher->setFuture(TaskScheduler::instance()->run(TaskScheduler::InteractiveLane, QString(),
+        [ruleSet = m_ruleSet, blocks = m_pending]() { return lintBlocks(ruleSet, blocks); }));
+}
+
+QList<QList<StyleIssue>> StyleLinter::lintBlocks(std::shared_ptr<const StyleRuleSet> ruleSet,
+                                                 const QList<BlockSnapshot>& blocks)
+{
+    QList<QList<StyleIssue>> results;
+    results.reserve(blocks.size());
+    for (const BlockSnapshot& block : blocks) {
+        results.append(ruleSet->lintBlock(block.text));
+    }
+    
+    return results;
+}
+
+void StyleLinter::onLintFinished()
+{
+    QFutureWatcher<QList<QList<StyleIssue>>>* watcher = m_watcher;
+    m_watcher = nullptr;
+    watcher->deleteLater();
+    
+    if (!watcher->isCanceled() && m_ruleSet && m_runningGeneration == m_generation) {
+        const QList<QList<StyleIssue>> results = watcher->result();
+        
+        QSet<int> relinted;   // Block positions whose marks are replaced
+        QList<QTextEdit::ExtraSelection> fresh;
+        for (int i = 0; i < results.size() && i < m_pending.size(); ++i) {
+            QTextBlock block = m_pendingBlocks[i].block();
+            if (!block.isValid() || relinted.contains(block.position())) {
+                continue;
+            }
+            
+            // Edited while the worker ran: offsets no longer line up
+            if (block.revision() != m_pending[i].revision || block.text() != m_pending[i].text) {
+                markDirty(block.position(), block.position() + block.length() - 1);
+                continue;
+            }
+            
+            relinted.insert(block.position());
+            for (const StyleIssue& issue : results[i]) {
+                QTextEdit::ExtraSelection selection;
+                selection.cursor = QTextCursor(m_document);
+                selection.cursor.setPosition(block.position() + issue.offset);
+                selection.cursor.setPosition(block.position() + issue.offset + issue.length, QTextCursor::KeepAnchor);
+                selection.format = formatForRule(issue.ruleIndex);
+                fresh.append(selection);
+            }
+        }
+        
+        m_marks.removeIf([this, &relinted](const QTextEdit::ExtraSelection& mark) {
+            return !mark.cursor.hasSelection() ||
+                   relinted.contains(m_document->findBlock(mark.cursor.selectionStart()).position());
+        });
+        m_marks.append(fresh);
+        emit marksChanged(m_marks);
+    }
+    
+    m_pending.clear();
+    m_pendingBlocks.clear();
+    
+    if (m_lintQueued) {
+        m_lintQueued = false;
+        startLint();
+    } else if (!m_dirtyStart.isNull() && !m_lintTimer->isActive()) {
+        m_lintTimer->start();
+    }
+}
+
+QTextCharFormat StyleLinter::formatForRule(int ruleIndex) const
+{
+    const StyleRule& rule = m_ruleSet->getRules().at(ruleIndex);
+    
+    QTextCharFormat format;
+    if (rule.kind == StyleRule::LongSentence) {
+        QColor tint = rule.color;
+        tint.setAlpha(40);
+        format.setBackground(tint);
+    } else {
+        format.setUnderlineStyle(QTextCharFormat::DotLine);
+        format.setUnderlineColor(rule.color);
+    }
+    
+    return format;
+}
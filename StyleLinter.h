@@ -0,0 +1,77 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef STYLELINTER_H
+#define STYLELINTER_H
+
+#include <QObject>
+#include <QString>
+#include <QList>
+#include <QTextCursor>
+#include <QTextEdit>
+#include <QFutureWatcher>
+#include <memory>
+#include "StyleRules.h"
+#include "TickService.h"
+
+class QTextDocument;
+
+// Lints one editor document against a StyleRuleSet. Edits mark a span of
+// blocks dirty; once typing pauses only those blocks are copied and linted
+// on a worker thread. Results are checked against the block revision they
+// were taken from, so anything edited meanwhile is dropped and relinted.
+class StyleLinter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit StyleLinter(QTextDocument* document, QObject *parent = nullptr);
+    ~StyleLinter();
+
+    void setRuleSet(std::shared_ptr<const StyleRuleSet> ruleSet);   // Null clears all marks
+    void rescan();   // Marks every block dirty; the lint itself still runs off-thread
+    bool isLinting() const { return m_watcher != nullptr; }
+    void setPaused(bool paused);   // Dirty blocks accumulate and are linted on resume
+    bool isPaused() const { return m_paused; }
+
+    // Constants
+    static const int LINT_DELAY_MS = 400;
+
+signals:
+    void marksChanged(const QList<QTextEdit::ExtraSelection>& marks);
+
+private slots:
+    void onContentsChange(int position, int charsRemoved, int charsAdded);
+    void startLint();
+    void onLintFinished();
+
+private:
+    struct BlockSnapshot {
+        QString text;
+        int revision;
+    };
+
+    static QList<QList<StyleIssue>> lintBlocks(std::shared_ptr<const StyleRuleSet> ruleSet,
+                                               const QList<BlockSnapshot>& blocks);
+    void markDirty(int from, int to);
+    QTextCharFormat formatForRule(int ruleIndex) const;
+
+    QTextDocument* m_document;
+    std::shared_ptr<const StyleRuleSet> m_ruleSet;
+    CoalescedTimer* m_lintTimer;
+    QTextCursor m_dirtyStart;                     // Null when nothing is dirty; tracks edits
+    QTextCursor m_dirtyEnd;
+    QList<BlockSnapshot> m_pending;               // Blocks handed to the running lint
+    QList<QTextCursor> m_pendingBlocks;           // Parallel to m_pending, follows edits
+    QList<QTextEdit::ExtraSelection> m_marks;
+    QFutureWatcher<QList<QList<StyleIssue>>>* m_watcher;   // Non-null while a lint runs
+    quint64 m_generation;                         // Bumped when rules change
+    quint64 m_runningGeneration;
+    bool m_lintQueued;
+    bool m_paused;
+};
+
+#endif // STYLELINTER_H
@@ -0,0 +1,226 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "StyleRules.h"
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QHash>
+#include <QDebug>
+
+namespace {
+
+int countWords(QStringView text)
+{
+    static const QRegularExpression whitespace("\\s+");
+    return static_cast<int>(text.toString().split(whitespace, Qt::SkipEmptyParts).size());
+}
+
+}
+
+std::shared_ptr<const StyleRuleSet> StyleRuleSet::compile(const QList<StyleRule>& rules)
+{
+    std::shared_ptr<StyleRuleSet> ruleSet(new StyleRuleSet());
+    
+    QStringList alternatives;
+    for (const StyleRule& rule : rules) {
+        if (!rule.enabled) {
+            continue;
+        }
+        
+        QString groupName;
+        if (rule.kind == StyleRule::LongSentence) {
+            ruleSet->m_longSentenceRule = ruleSet->m_rules.size();
+        } else {
+            // A broken user pattern disables that rule, not the whole set
+            if (!QRegularExpression(rule.pattern).isValid()) {
+                qDebug() << "Skipping style rule with invalid pattern:" << rule.id;
+                continue;
+            }
+            groupName = QString("r%1").arg(ruleSet->m_rules.size());
+            alternatives.append(QString("(?<%1>%2)").arg(groupName, rule.pattern));
+        }
+        
+        ruleSet->m_rules.append(rule);
+        ruleSet->m_groupNames.append(groupName);
+    }
+    
+    if (!alternatives.isEmpty()) {
+        ruleSet->m_combined = QRegularExpression(alternatives.join('|'),
+                                                 QRegularExpression::CaseInsensitiveOption |
+                                                 QRegularExpression::UseUnicodePropertiesOption);
+        ruleSet->m_combined.optimize();
+    }
+    
+    return ruleSet;
+}
+
+QList<StyleRule> StyleRuleSet::defaultRules()
+{
+    QList<StyleRule> rules;
+    
+    StyleRule adverbs;
+    adverbs.id = "adverbs";
+    adverbs.name = "Adverb density";
+    adverbs.kind = StyleRule::Density;
+    adverbs.pattern = "\\b(?!(?:only|family|early|reply|apply|supply|holy|ugly|belly|rely|july|italy|lily|jelly|"
+                      "silly|daily|likely|lonely|lovely|friendly|ally|bully|curly|fly|butterfly|assembly)\\b)"
+                      "\\w{2,}ly\\b";
+    adverbs.threshold = 3;
+    adverbs.color = QColor(0, 150, 136);
+    rules.append(adverbs);
+    
+    StyleRule passive;
+    passive.id = "passive";
+    passive.name = "Passive voice";
+    passive.pattern = "\\b(?:am|is|are|was|were|be|been|being)\\s+(?:\\w+ed|\\w+en|made|built|caught|found|"
+                      "held|kept|left|lost|meant|paid|said|sent|sold|taught|told|thought)\\b";
+    passive.color = QColor(63, 81, 181);
+    rules.append(passive);
+    
+    StyleRule filter;
+    filter.id = "filter";
+    filter.name = "Filter words";
+    filter.pattern = "\\b(?:saw|see|sees|heard|hear|felt|feel|feels|noticed|realized|realised|wondered|"
+                     "seemed|seems|decided|watched|looked)\\b";
+    filter.color = QColor(156, 39, 176);
+    rules.append(filter);
+    
+    StyleRule longSentences;
+    longSentences.id = "long-sentences";
+    longSentences.name = "Long sentences";
+    longSentences.kind = StyleRule::LongSentence;
+    longSentences.threshold = 35;
+    longSentences.color = QColor(233, 30, 99);
+    rules.append(longSentences);
+    
+    return rules;
+}
+
+QList<StyleRule> StyleRuleSet::loadRules(const QString& filePath)
+{
+    QList<StyleRule> rules = defaultRules();
+    
+    QFile file(filePath);
+    if (!file.exists()) {
+        return rules;
+    }
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "Cannot open style rules:" << filePath;
+        return rules;
+    }
+    
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+    if (!doc.isObject()) {
+        qDebug() << "Invalid style rules format:" << filePath;
+        return rules;
+    }
+    
+    // Entries override built-in rules by ID or add new pattern rules
+    QHash<QString, int> indexById;
+    for (int i = 0; i < rules.size(); ++i) {
+        indexById.insert(rules[i].id, i);
+    }
+    
+    const QJsonArray entries = doc.object()["rules"].toArray();
+    for (const auto& value : entries) {
+        QJsonObject object = value.toObject();
+        QString id = object["id"].toString();
+        if (id.isEmpty()) {
+            continue;
+        }
+        
+        int index = indexById.value(id, -1);
+        if (index < 0) {
+            StyleRule rule;
+            rule.id = id;
+            rule.name = id;
+            rule.color = QColor(121, 85, 72);
+            index = rules.size();
+            indexById.insert(id, index);
+            rules.append(rule);
+        }
+        
+        StyleRule& rule = rules[index];
+        rule.name = object["name"].toString(rule.name);
+        rule.pattern = object["pattern"].toString(rule.pattern);
+        rule.threshold = object["threshold"].toInt(rule.threshold);
+        rule.enabled = object["enabled"].toBool(rule.enabled);
+        if (object.contains("color")) {
+            rule.color = QColor(object["color"].toString());
+        }
+        QString kind = object["kind"].toString();
+        if (kind == "density") {
+            rule.kind = StyleRule::Density;
+        } else if (kind == "long-sentence") {
+            rule.kind = StyleRule::LongSentence;
+        } else if (kind == "pattern") {
+            rule.kind = StyleRule::Pattern;
+        }
+    }
+    
+    return rules;
+}
+
+QList<StyleIssue> StyleRuleSet::lintBlock(const QString& text) const
+{
+    QList<StyleIssue> issues;
+    if (text.trimmed().isEmpty() || text.trimmed().startsWith(QLatin1Char('#'))) {
+        return issues;
+    }
+    
+    // One pass of the combined pattern; the named group says which rule hit
+    QList<QList<StyleIssue>> matchesByRule(m_rules.size());
+    if (m_combined.isValid() && !m_combined.pattern().isEmpty()) {
+        QRegularExpressionMatchIterator it = m_combined.globalMatch(text);
+        while (it.hasNext()) {
+            QRegularExpressionMatch match = it.next();
+            for (int i = 0; i < m_groupNames.size(); ++i) {
+                if (!m_groupNames[i].isEmpty() && match.capturedStart(m_groupNames[i]) >= 0) {
+                    matchesByRule[i].append({static_cast<int>(match.capturedStart()),
+                                             static_cast<int>(match.capturedLength()), i});
+                    break;
+                }
+            }
+        }
+    }
+    
+    int wordCount = 0;
+    for (int i = 0; i < m_rules.size(); ++i) {
+        if (m_rules[i].kind != StyleRule::Density || matchesByRule[i].isEmpty()) {
+            continue;
+        }
+        if (wordCount == 0) {
+            wordCount = countWords(text);
+        }
+        
+        // Density rules only fire once the paragraph is over the limit
+        if (matchesByRule[i].size() * 100 < m_rules[i].threshold * wordCount) {
+            matchesByRule[i].clear();
+        }
+    }
+    
+    for (const QList<StyleIssue>& ruleIssues : std::as_const(matchesByRule)) {
+        issues.append(ruleIssues);
+    }
+    
+    if (m_longSentenceRule >= 0) {
+        static const QRegularExpression sentencePattern("[^.!?\\x{2026}]+[.!?\\x{2026}]*");
+        QRegularExpressionMatchIterator it = sentencePattern.globalMatch(text);
+        while (it.hasNext()) {
+            QRegularExpressionMatch match = it.next();
+            QStringView sentence = match.capturedView().trimmed();
+            if (countWords(sentence) > m_rules[m_longSentenceRule].threshold) {
+                int leading = static_cast<int>(sentence.data() - match.capturedView().data());
+                issues.append({static_cast<int>(match.capturedStart()) + leading,
+                               static_cast<int>(sentence.size()), m_longSentenceRule});
+            }
+        }
+    }
+    
+    return issues;
+}
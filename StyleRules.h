@@ -0,0 +1,61 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef STYLERULES_H
+#define STYLERULES_H
+
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QColor>
+#include <QRegularExpression>
+#include <memory>
+
+struct StyleRule {
+    enum Kind {
+        Pattern,        // Every match is flagged
+        Density,        // Matches are flagged when they exceed threshold per 100 words
+        LongSentence    // Sentences longer than threshold words are flagged
+    };
+
+    QString id;
+    QString name;
+    Kind kind = Pattern;
+    QString pattern;     // Regular expression for Pattern and Density rules
+    int threshold = 0;
+    QColor color;
+    bool enabled = true;
+};
+
+struct StyleIssue {
+    int offset;      // Within the block
+    int length;
+    int ruleIndex;
+};
+
+// Immutable, compiled rule set shared by every editor's linter. All
+// pattern rules are folded into one alternation so each block is matched
+// in a single pass; safe to use from worker threads.
+class StyleRuleSet
+{
+public:
+    static std::shared_ptr<const StyleRuleSet> compile(const QList<StyleRule>& rules);
+    static QList<StyleRule> defaultRules();
+    static QList<StyleRule> loadRules(const QString& filePath);   // Defaults if missing or invalid
+
+    const QList<StyleRule>& getRules() const { return m_rules; }
+    QList<StyleIssue> lintBlock(const QString& text) const;
+
+private:
+    StyleRuleSet() = default;
+
+    QList<StyleRule> m_rules;            // Enabled rules only
+    QRegularExpression m_combined;       // Named group "r<index>" per pattern rule
+    QStringList m_groupNames;            // Parallel to m_rules; empty for non-pattern rules
+    int m_longSentenceRule = -1;
+};
+
+#endif // STYLERULES_H
@@ -0,0 +1,136 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "TaskScheduler.h"
+
+thread_local int TaskScheduler::s_workerIndex = -1;
+
+TaskScheduler* TaskScheduler::instance()
+{
+    static TaskScheduler scheduler;
+    return &scheduler;
+}
+
+TaskScheduler::TaskScheduler()
+    : m_pendingJobs(0)
+    , m_nextWorker(0)
+    , m_stopping(false)
+{
+    // One worker per core; the GUI thread only submits
+    const int workerCount = qMax(2, QThread::idealThreadCount());
+    for (int i = 0; i < workerCount; ++i) {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+    for (int i = 0; i < workerCount; ++i) {
+        m_workers[i]->thread = QThread::create([this, i]() { workerLoop(i); });
+        m_workers[i]->thread->setObjectName(QString("TaskScheduler %1").arg(i));
+        m_workers[i]->thread->start(QThread::LowPriority);
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    // Workers only look at m_stopping once the queues are empty, so every job
+    // already submitted still runs; saves queued during shutdown reach the disk
+    {
+        QMutexLocker locker(&m_sleepMutex);
+        m_stopping = true;
+        m_wakeUp.wakeAll();
+    }
+    
+    for (const auto& worker : m_workers) {
+        worker->thread->wait();
+        delete worker->thread;
+    }
+}
+
+void TaskScheduler::submit(Lane lane, std::function<void()> job)
+{
+    // Jobs spawned by a worker stay local; others are spread round robin
+    int index = s_workerIndex >= 0 ? s_workerIndex
+                                   : static_cast<int>(m_nextWorker++ % m_workers.size());
+    {
+        QMutexLocker locker(&m_workers[index]->mutex);
+        m_workers[index]->lanes[lane].push_back(std::move(job));
+    }
+    m_pendingJobs++;
+    
+    QMutexLocker locker(&m_sleepMutex);
+    m_wakeUp.wakeOne();
+}
+
+void TaskScheduler::registerKey(const QString& key, std::function<void()> cancel)
+{
+    if (key.isEmpty()) {
+        return;
+    }
+    
+    std::function<void()> previous;
+    {
+        QMutexLocker locker(&m_keyMutex);
+        previous = m_cancelByKey.value(key);
+        m_cancelByKey.insert(key, std::move(cancel));
+    }
+    
+    // Cancelling a finished future is a no-op, so stale entries are harmless
+    if (previous) {
+        previous();
+    }
+}
+
+bool TaskScheduler::takeJob(int workerIndex, std::function<void()>& job)
+{
+    const int workerCount = static_cast<int>(m_workers.size());
+    
+    for (int lane = 0; lane < LaneCount; ++lane) {
+        // Own newest job first: its data is most likely still in cache
+        Worker* own = m_workers[workerIndex].get();
+        {
+            QMutexLocker locker(&own->mutex);
+            if (!own->lanes[lane].empty()) {
+                job = std::move(own->lanes[lane].back());
+                own->lanes[lane].pop_back();
+                m_pendingJobs--;
+                return true;
+            }
+        }
+        
+        // Then steal the oldest job of the same lane from someone else
+        for (int offset = 1; offset < workerCount; ++offset) {
+            Worker* victim = m_workers[(workerIndex + offset) % workerCount].get();
+            QMutexLocker locker(&victim->mutex);
+            if (!victim->lanes[lane].empty()) {
+                job = std::move(victim->lanes[lane].front());
+                victim->lanes[lane].pop_front();
+                m_pendingJobs--;
+                return true;
+            }
+        }
+    }
+    
+    return false;
+}
+
+void TaskScheduler::workerLoop(int workerIndex)
+{
+    s_workerIndex = workerIndex;
+    
+    while (true) {
+        std::function<void()> job;
+        if (takeJob(workerIndex, job)) {
+            job();
+            continue;
+        }
+        
+        QMutexLocker locker(&m_sleepMutex);
+        if (m_stopping) {
+            return;
+        }
+        if (m_pendingJobs.load() <= 0) {
+            m_wakeUp.wait(&m_sleepMutex);
+        }
+    }
+}
@@ -0,0 +1,208 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef TASKSCHEDULER_H
+#define TASKSCHEDULER_H
+
+#include <QString>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QThread>
+#include <QFuture>
+#include <QPromise>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// The one worker pool for all background work. Jobs go into priority
+// lanes; each worker owns a deque per lane, pops its own newest job and
+// steals the oldest from others when idle, always draining higher lanes
+// first. Results come back as ordinary QFutures, so callers keep using
+// QFutureWatcher, and QFuture::cancel() is the cancellation token: queued
+// jobs of a cancelled future are skipped and long jobs poll
+// QPromise::isCanceled(). Submitting under a key cancels the previous
+// future with that key, so repeated requests collapse into the latest.
+class TaskScheduler
+{
+public:
+    enum Lane {
+        InteractiveLane,   // Feedback the user is waiting on while typing
+        SaveLane,          // Writes to disk
+        IndexLane,         // Indexes other features read from
+        AnalysisLane,      // Whole-manuscript reports
+        LaneCount
+    };
+
+    static TaskScheduler* instance();
+    ~TaskScheduler();
+
+    int getWorkerCount() const { return static_cast<int>(m_workers.size()); }
+
+    // Runs function() and reports its return value
+    template <typename Function>
+    auto run(Lane lane, const QString& key, Function function)
+        -> QFuture<std::invoke_result_t<Function>>;
+
+    // Runs function(promise); the function reports results and progress itself
+    template <typename T, typename Function>
+    QFuture<T> runWithPromise(Lane lane, const QString& key, Function function);
+
+    // One job per item; results keep the order of the sequence
+    template <typename Sequence, typename Map>
+    auto mapped(Lane lane, const QString& key, const Sequence& sequence, Map map)
+        -> QFuture<std::decay_t<std::invoke_result_t<Map, const typename Sequence::value_type&>>>;
+
+    // One job per item, folded into a single result in completion order
+    template <typename ResultType, typename Sequence, typename Map, typename Reduce>
+    QFuture<ResultType> mappedReduced(Lane lane, const QString& key, const Sequence& sequence, Map map, Reduce reduce);
+
+private:
+    TaskScheduler();
+
+    struct Worker {
+        QMutex mutex;
+        std::deque<std::function<void()>> lanes[LaneCount];
+        QThread* thread = nullptr;
+    };
+
+    void submit(Lane lane, std::function<void()> job);
+    void registerKey(const QString& key, std::function<void()> cancel);
+    bool takeJob(int workerIndex, std::function<void()>& job);
+    void workerLoop(int workerIndex);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<int> m_pendingJobs;
+    std::atomic<unsigned> m_nextWorker;      // Round robin for jobs from outside the pool
+    QMutex m_sleepMutex;
+    QWaitCondition m_wakeUp;
+    bool m_stopping;
+    QMutex m_keyMutex;
+    QHash<QString, std::function<void()>> m_cancelByKey;   // Cancels the latest future per key
+
+    static thread_local int s_workerIndex;   // -1 outside the pool
+};
+
+template <typename Function>
+auto TaskScheduler::run(Lane lane, const QString& key, Function function)
+    -> QFuture<std::invoke_result_t<Function>>
+{
+    using Result = std::invoke_result_t<Function>;
+    return runWithPromise<Result>(lane, key, [function](QPromise<Result>& promise) mutable {
+        if constexpr (std::is_void_v<Result>) {
+            Q_UNUSED(promise);
+            function();
+        } else {
+            promise.addResult(function());
+        }
+    });
+}
+
+template <typename T, typename Function>
+QFuture<T> TaskScheduler::runWithPromise(Lane lane, const QString& key, Function function)
+{
+    auto promise = std::make_shared<QPromise<T>>();
+    QFuture<T> future = promise->future();
+    promise->start();
+    registerKey(key, [future]() mutable { future.cancel(); });
+    
+    submit(lane, [promise, function]() mutable {
+        if (!promise->isCanceled()) {
+            function(*promise);
+        }
+        promise->finish();
+    });
+    
+    return future;
+}
+
+template <typename Sequence, typename Map>
+auto TaskScheduler::mapped(Lane lane, const QString& key, const Sequence& sequence, Map map)
+    -> QFuture<std::decay_t<std::invoke_result_t<Map, const typename Sequence::value_type&>>>
+{
+    using Result = std::decay_t<std::invoke_result_t<Map, const typename Sequence::value_type&>>;
+    
+    auto promise = std::make_shared<QPromise<Result>>();
+    QFuture<Result> future = promise->future();
+    const int count = static_cast<int>(sequence.size());
+    promise->start();
+    promise->setProgressRange(0, count);
+    registerKey(key, [future]() mutable { future.cancel(); });
+    if (count == 0) {
+        promise->finish();
+        return future;
+    }
+    
+    auto remaining = std::make_shared<std::atomic<int>>(count);
+    auto sharedMap = std::make_shared<Map>(std::move(map));
+    for (int i = 0; i < count; ++i) {
+        submit(lane, [promise, remaining, sharedMap, item = sequence.at(i), i, count]() {
+            if (!promise->isCanceled()) {
+                promise->addResult((*sharedMap)(item), i);
+            }
+            int left = --*remaining;
+            promise->setProgressValue(count - left);
+            if (left == 0) {
+                promise->finish();
+            }
+        });
+    }
+    
+    return future;
+}
+
+template <typename ResultType, typename Sequence, typename Map, typename Reduce>
+QFuture<ResultType> TaskScheduler::mappedReduced(Lane lane, const QString& key, const Sequence& sequence,
+                                                 Map map, Reduce reduce)
+{
+    struct State {
+        QMutex mutex;
+        ResultType result;
+        std::atomic<int> remaining;
+    };
+    
+    auto promise = std::make_shared<QPromise<ResultType>>();
+    QFuture<ResultType> future = promise->future();
+    const int count = static_cast<int>(sequence.size());
+    promise->start();
+    promise->setProgressRange(0, count);
+    registerKey(key, [future]() mutable { future.cancel(); });
+    
+    auto state = std::make_shared<State>();
+    state->remaining = count;
+    if (count == 0) {
+        promise->addResult(state->result);
+        promise->finish();
+        return future;
+    }
+    
+    auto sharedMap = std::make_shared<Map>(std::move(map));
+    for (int i = 0; i < count; ++i) {
+        submit(lane, [promise, state, sharedMap, reduce, item = sequence.at(i), count]() {
+            if (!promise->isCanceled()) {
+                auto mappedItem = (*sharedMap)(item);
+                QMutexLocker locker(&state->mutex);
+                reduce(state->result, mappedItem);
+            }
+            int left = --state->remaining;
+            promise->setProgressValue(count - left);
+            if (left == 0) {
+                if (!promise->isCanceled()) {
+                    promise->addResult(std::move(state->result));
+                }
+                promise->finish();
+            }
+        });
+    }
+    
+    return future;
+}
+
+#endif // TASKSCHEDULER_H
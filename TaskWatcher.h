@@ -0,0 +1,105 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef TASKWATCHER_H
+#define TASKWATCHER_H
+
+#include <QObject>
+#include <QFuture>
+#include <QFutureWatcher>
+#include <utility>
+
+// Watches one TaskScheduler job at a time for an owner on the GUI thread.
+// The QFutureWatcher only exists while the job runs. stop() and the
+// destructor wait for the job and drop its finished callout, which is
+// already queued by then and would otherwise reach an owner that has
+// moved on.
+template <typename T>
+class TaskWatcher
+{
+public:
+    explicit TaskWatcher(QObject* owner);
+    ~TaskWatcher();
+
+    bool isRunning() const { return m_watcher != nullptr; }
+
+    // onFinished runs in the owner's thread once the job ends or is cancelled
+    template <typename Callback>
+    void start(const QFuture<T>& future, Callback onFinished);
+
+    // Asks a running job to stop early; the finished callout still arrives
+    void cancel();
+
+    // Cancels and waits for a running job; the finished callout never arrives
+    void stop();
+
+    // From the finished callout: releases the watcher and hands over its future
+    QFuture<T> finish();
+
+private:
+    TaskWatcher(const TaskWatcher&) = delete;
+    TaskWatcher& operator=(const TaskWatcher&) = delete;
+
+    QObject* m_owner;
+    QFutureWatcher<T>* m_watcher;   // Non-null while a job runs
+};
+
+template <typename T>
+TaskWatcher<T>::TaskWatcher(QObject* owner)
+    : m_owner(owner)
+    , m_watcher(nullptr)
+{
+}
+
+template <typename T>
+TaskWatcher<T>::~TaskWatcher()
+{
+    stop();
+}
+
+template <typename T>
+template <typename Callback>
+void TaskWatcher<T>::start(const QFuture<T>& future, Callback onFinished)
+{
+    stop();
+    
+    m_watcher = new QFutureWatcher<T>(m_owner);
+    QObject::connect(m_watcher, &QFutureWatcherBase::finished, m_owner, std::move(onFinished));
+    m_watcher->setFuture(future);
+}
+
+template <typename T>
+void TaskWatcher<T>::cancel()
+{
+    if (m_watcher) {
+        m_watcher->cancel();
+    }
+}
+
+template <typename T>
+void TaskWatcher<T>::stop()
+{
+    if (!m_watcher) {
+        return;
+    }
+    
+    m_watcher->cancel();
+    m_watcher->waitForFinished();
+    QObject::disconnect(m_watcher, nullptr, m_owner, nullptr);
+    m_watcher->deleteLater();
+    m_watcher = nullptr;
+}
+
+template <typename T>
+QFuture<T> TaskWatcher<T>::finish()
+{
+    QFuture<T> future = m_watcher->future();
+    m_watcher->deleteLater();
+    m_watcher = nullptr;
+    return future;
+}
+
+#endif // TASKWATCHER_H
@@ -0,0 +1,163 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "TextStatistics.h"
+
+namespace {
+
+bool isVowel(QChar c)
+{
+    switch (c.toLower().unicode()) {
+        case 'a': case 'e': case 'i': case 'o': case 'u': case 'y':
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool isSentenceEnd(QChar c)
+{
+    return c == QLatin1Char('.') || c == QLatin1Char('!') || c == QLatin1Char('?') || c == QChar(0x2026);
+}
+
+bool isQuote(QChar c)
+{
+    return c == QLatin1Char('"') || c == QChar(0x201C) || c == QChar(0x201D);
+}
+
+}
+
+BlockStatistics& BlockStatistics::operator+=(const BlockStatistics& other)
+{
+    words += other.words;
+    sentences += other.sentences;
+    syllables += other.syllables;
+    dialogueWords += other.dialogueWords;
+    return *this;
+}
+
+double DocumentStatistics::averageSentenceLength() const
+{
+    return totals.sentences > 0 ? static_cast<double>(totals.words) / totals.sentences : 0.0;
+}
+
+double DocumentStatistics::fleschReadingEase() const
+{
+    if (totals.words == 0 || totals.sentences == 0) {
+        return 0.0;
+    }
+    
+    return 206.835 - 1.015 * averageSentenceLength()
+                   - 84.6 * static_cast<double>(totals.syllables) / totals.words;
+}
+
+double DocumentStatistics::fleschKincaidGrade() const
+{
+    if (totals.words == 0 || totals.sentences == 0) {
+        return 0.0;
+    }
+    
+    return 0.39 * averageSentenceLength()
+         + 11.8 * static_cast<double>(totals.syllables) / totals.words - 15.59;
+}
+
+double DocumentStatistics::dialogueRatio() const
+{
+    return totals.words > 0 ? static_cast<double>(totals.dialogueWords) / totals.words : 0.0;
+}
+
+namespace TextStatistics {
+
+BlockStatistics analyzeBlock(const QString& text)
+{
+    BlockStatistics stats;
+    
+    // Headings are not prose; count their words but nothing else
+    const bool heading = text.trimmed().startsWith(QLatin1Char('#'));
+    
+    bool inQuote = false;
+    bool wordsSinceSentenceEnd = false;
+    int i = 0;
+    while (i < text.size()) {
+        if (text[i].isSpace()) {
+            ++i;
+            continue;
+        }
+        
+        // One whitespace-delimited token
+        int start = i;
+        QString letters;
+        bool tokenInQuote = inQuote;
+        while (i < text.size() && !text[i].isSpace()) {
+            QChar c = text[i];
+            if (isQuote(c)) {
+                // Curly quotes say which way they face; straight ones toggle
+                inQuote = (c == QChar(0x201C)) ? true : (c == QChar(0x201D)) ? false : !inQuote;
+                tokenInQuote = tokenInQuote || inQuote;
+            } else if (c.isLetter()) {
+                letters.append(c);
+            }
+            ++i;
+        }
+        
+        stats.words++;
+        if (heading) {
+            continue;
+        }
+        
+        if (!letters.isEmpty()) {
+            stats.syllables += countSyllables(letters);
+            wordsSinceSentenceEnd = true;
+        }
+        if (tokenInQuote) {
+            stats.dialogueWords++;
+        }
+        
+        // A terminator inside the token ends a sentence ("end." or "end?\"")
+        for (int j = i - 1; j >= start; --j) {
+            if (isSentenceEnd(text[j])) {
+                if (wordsSinceSentenceEnd) {
+                    stats.sentences++;
+                    wordsSinceSentenceEnd = false;
+                }
+                break;
+            }
+            if (text[j].isLetterOrNumber()) {
+                break;
+            }
+        }
+    }
+    
+    // A paragraph ending without punctuation still holds a sentence
+    if (wordsSinceSentenceEnd) {
+        stats.sentences++;
+    }
+    
+    return stats;
+}
+
+int countSyllables(const QString& word)
+{
+    int count = 0;
+    bool previousVowel = false;
+    for (QChar c : word) {
+        bool vowel = isVowel(c);
+        if (vowel && !previousVowel) {
+            count++;
+        }
+        previousVowel = vowel;
+    }
+    
+    // Silent trailing "e" ("time"), but not "-le" ("table")
+    if (word.size() > 2 && word.endsWith(QLatin1Char('e'), Qt::CaseInsensitive) &&
+        !word.endsWith(QLatin1String("le"), Qt::CaseInsensitive) && count > 1) {
+        count--;
+    }
+    
+    return qMax(1, count);
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef TEXTSTATISTICS_H
+#define TEXTSTATISTICS_H
+
+#include <QString>
+#include <QTextBlockUserData>
+
+// Counts for one paragraph; sums of these give document statistics
+struct BlockStatistics {
+    int words = 0;             // Whitespace-separated, matching the word counter
+    int sentences = 0;
+    int syllables = 0;
+    int dialogueWords = 0;     // Words inside quotation marks
+
+    BlockStatistics& operator+=(const BlockStatistics& other);
+};
+
+struct DocumentStatistics {
+    BlockStatistics totals;
+    int paragraphs = 0;        // Non-empty blocks
+
+    double averageSentenceLength() const;
+    double fleschReadingEase() const;
+    double fleschKincaidGrade() const;
+    double dialogueRatio() const;   // 0..1
+};
+
+// Cached per-block result, valid while the block's revision is unchanged
+class StatisticsBlockData : public QTextBlockUserData
+{
+public:
+    StatisticsBlockData(int revision, const BlockStatistics& statistics)
+        : m_revision(revision), m_statistics(statistics) {}
+
+    int getRevision() const { return m_revision; }
+    const BlockStatistics& getStatistics() const { return m_statistics; }
+
+private:
+    int m_revision;
+    BlockStatistics m_statistics;
+};
+
+namespace TextStatistics {
+
+BlockStatistics analyzeBlock(const QString& text);
+int countSyllables(const QString& word);   // English vowel-group heuristic
+
+}
+
+#endif // TEXTSTATISTICS_H
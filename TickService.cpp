@@ -0,0 +1,177 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "TickService.h"
+#include <QCoreApplication>
+#include <QPointer>
+#include <limits>
+
+TickService* TickService::instance()
+{
+    // Owned by the application so it goes away with the event loop
+    static TickService* service = new TickService(QCoreApplication::instance());
+    return service;
+}
+
+TickService::TickService(QObject *parent)
+    : QObject(parent)
+    , m_timer(new QTimer(this))
+    , m_totalWakeups(0)
+    , m_armedFor(-1)
+{
+    m_clock.start();
+    
+    // Slack is applied per timer here, so the shared timer itself is exact
+    m_timer->setSingleShot(true);
+    m_timer->setTimerType(Qt::PreciseTimer);
+    connect(m_timer, &QTimer::timeout, this, &TickService::onWakeup);
+}
+
+TickService::~TickService() = default;
+
+int TickService::getWakeupsPerMinute() const
+{
+    const qint64 windowStart = now() - WAKEUP_WINDOW_MS;
+    int count = 0;
+    for (auto it = m_wakeups.crbegin(); it != m_wakeups.crend() && *it > windowStart; ++it) {
+        ++count;
+    }
+    
+    return count;
+}
+
+void TickService::arm(CoalescedTimer* timer)
+{
+    if (!m_active.contains(timer)) {
+        m_active.append(timer);
+    }
+    reschedule();
+}
+
+void TickService::disarm(CoalescedTimer* timer)
+{
+    if (m_active.removeOne(timer)) {
+        reschedule();
+    }
+}
+
+void TickService::reschedule()
+{
+    if (m_active.isEmpty()) {
+        m_timer->stop();
+        m_armedFor = -1;
+        return;
+    }
+    
+    // Sleep as long as the most urgent timer allows
+    qint64 wakeAt = std::numeric_limits<qint64>::max();
+    for (const CoalescedTimer* timer : std::as_const(m_active)) {
+        wakeAt = qMin(wakeAt, timer->m_deadline + timer->slack());
+    }
+    
+    if (m_timer->isActive() && wakeAt == m_armedFor) {
+        return;
+    }
+    m_armedFor = wakeAt;
+    m_timer->start(static_cast<int>(qMax<qint64>(0, wakeAt - now())));
+}
+
+void TickService::onWakeup()
+{
+    const qint64 current = now();
+    m_armedFor = -1;
+    m_totalWakeups++;
+    m_wakeups.append(current);
+    while (!m_wakeups.isEmpty() && m_wakeups.first() <= current - WAKEUP_WINDOW_MS) {
+        m_wakeups.removeFirst();
+    }
+    
+    // Settle every due timer before emitting, so handlers can restart them
+    QList<QPointer<CoalescedTimer>> due;
+    for (int i = m_active.size() - 1; i >= 0; --i) {
+        CoalescedTimer* timer = m_active[i];
+        if (timer->m_deadline > current) {
+            continue;
+        }
+        
+        if (timer->m_singleShot) {
+            timer->m_active = false;
+            m_active.removeAt(i);
+        } else {
+            timer->m_deadline = current + timer->m_interval;
+        }
+        due.prepend(timer);
+    }
+    
+    for (const QPointer<CoalescedTimer>& timer : std::as_const(due)) {
+        if (timer) {
+            emit timer->timeout();
+        }
+    }
+    
+    reschedule();
+    emit ticked();
+}
+
+CoalescedTimer::CoalescedTimer(QObject *parent)
+    : QObject(parent)
+    , m_interval(0)
+    , m_singleShot(false)
+    , m_active(false)
+    , m_timerType(Qt::CoarseTimer)
+    , m_deadline(0)
+{
+}
+
+CoalescedTimer::~CoalescedTimer()
+{
+    stop();
+}
+
+int CoalescedTimer::remainingTime() const
+{
+    if (!m_active) {
+        return -1;
+    }
+    
+    return static_cast<int>(qMax<qint64>(0, m_deadline - TickService::instance()->now()));
+}
+
+void CoalescedTimer::start()
+{
+    TickService* service = TickService::instance();
+    m_deadline = service->now() + m_interval;
+    m_active = true;
+    service->arm(this);
+}
+
+void CoalescedTimer::start(int milliseconds)
+{
+    setInterval(milliseconds);
+    start();
+}
+
+void CoalescedTimer::stop()
+{
+    if (!m_active) {
+        return;
+    }
+    
+    m_active = false;
+    TickService::instance()->disarm(this);
+}
+
+qint64 CoalescedTimer::slack() const
+{
+    switch (m_timerType) {
+        case Qt::PreciseTimer:
+            return 0;
+        case Qt::VeryCoarseTimer:
+            return TickService::VERY_COARSE_SLACK_MS;
+        default:
+            return static_cast<qint64>(m_interval) * TickService::COARSE_SLACK_PERCENT / 100;
+    }
+}
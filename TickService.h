@@ -0,0 +1,102 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef TICKSERVICE_H
+#define TICKSERVICE_H
+
+#include <QObject>
+#include <QList>
+#include <QTimer>
+#include <QElapsedTimer>
+
+class CoalescedTimer;
+
+// One shared wakeup for all deadline timers. Each CoalescedTimer may fire
+// up to its slack late, so the service sleeps until the most urgent
+// timer's latest acceptable moment and then fires everything already due
+// in one batch. With many editors open their debounce timers collapse into
+// a handful of wakeups instead of one each.
+class TickService : public QObject
+{
+    Q_OBJECT
+
+public:
+    static TickService* instance();
+    ~TickService();
+
+    int getWakeupsPerMinute() const;
+    qint64 getTotalWakeups() const { return m_totalWakeups; }
+    int getActiveTimerCount() const { return m_active.size(); }
+
+    // Constants
+    static const int COARSE_SLACK_PERCENT = 20;     // Of the interval
+    static const int VERY_COARSE_SLACK_MS = 1000;
+    static const int WAKEUP_WINDOW_MS = 60000;
+
+signals:
+    void ticked();   // After each shared wakeup; piggyback periodic UI updates here
+
+private slots:
+    void onWakeup();
+
+private:
+    explicit TickService(QObject *parent = nullptr);
+
+    friend class CoalescedTimer;
+    void arm(CoalescedTimer* timer);
+    void disarm(CoalescedTimer* timer);
+    void reschedule();
+    qint64 now() const { return m_clock.elapsed(); }
+
+    QTimer* m_timer;
+    QElapsedTimer m_clock;
+    QList<CoalescedTimer*> m_active;
+    QList<qint64> m_wakeups;       // Wakeup times within the last window
+    qint64 m_totalWakeups;
+    qint64 m_armedFor;             // Wake time m_timer is set for
+};
+
+// QTimer look-alike whose timeouts are batched by TickService. The timer
+// type sets the slack: precise timers fire on time, coarse ones up to
+// COARSE_SLACK_PERCENT of their interval late, very coarse ones up to a
+// second late.
+class CoalescedTimer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit CoalescedTimer(QObject *parent = nullptr);
+    ~CoalescedTimer();
+
+    void setInterval(int milliseconds) { m_interval = qMax(0, milliseconds); }
+    int interval() const { return m_interval; }
+    void setSingleShot(bool singleShot) { m_singleShot = singleShot; }
+    bool isSingleShot() const { return m_singleShot; }
+    void setTimerType(Qt::TimerType type) { m_timerType = type; }
+    Qt::TimerType timerType() const { return m_timerType; }
+    bool isActive() const { return m_active; }
+    int remainingTime() const;
+
+public slots:
+    void start();
+    void start(int milliseconds);
+    void stop();
+
+signals:
+    void timeout();
+
+private:
+    friend class TickService;
+    qint64 slack() const;
+
+    int m_interval;
+    bool m_singleShot;
+    bool m_active;
+    Qt::TimerType m_timerType;
+    qint64 m_deadline;
+};
+
+#endif // TICKSERVICE_H
@@ -7,6 +7,7 @@
 #include "UpdateManager.h"
 #include "ProjectTreeWidget.h"
 #include "ProjectManager.h"
+#include "Workspace.h"
 #include <QDir>
 #include <QFile>
 #include <QTextStream>
@@ -18,11 +19,13 @@ const QString UpdateManager::BACKUP_SUFFIX = ".neurodraft_backup";
 const int UpdateManager::MAX_BACKUPS = 5;
 const QRegularExpression UpdateManager::CHAPTER_REGEX(R"(^#\s+(.+)$)", QRegularExpression::MultilineOption);
 const QRegularExpression UpdateManager::SUBSECTION_REGEX(R"(^##\s+(.+)$)", QRegularExpression::MultilineOption);
+const QRegularExpression UpdateManager::HEADING_NUMBER_REGEX(R"(^(?:Chapter\s+\d+|\d+(?:\.\d+)+)\s*[:.\-]\s*)");
+const QRegularExpression UpdateManager::UNTITLED_HEADING_REGEX(R"(^(?:Chapter\s+\d+|\d+(?:\.\d+)+)$)");
 
 UpdateManager::UpdateManager(QObject *parent)
     : QObject(parent)
     , m_projectTree(nullptr)
-    , m_projectManager(nullptr)
+    , m_workspace(nullptr)
 {
 }
 
@@ -33,9 +36,9 @@ void UpdateManager::setProjectTree(ProjectTreeWidget* tree)
     m_projectTree = tree;
 }
 
-void UpdateManager::setProjectManager(ProjectManager* manager)
+void UpdateManager::setWorkspace(Workspace* workspace)
 {
-    m_projectManager = manager;
+    m_workspace = workspace;
 }
 
 bool UpdateManager::renumberChapters(const QString& projectPath)
@@ -47,6 +50,12 @@ bool UpdateManager::renumberChapters(const QString& projectPath)
     
     qDebug() << "Renumbering chapters for project:" << projectPath;
     
+    // Computed numbering: headings carry no numbers, so there is nothing to write
+    if (usesComputedNumbering(projectPath)) {
+        emit numberingUpdated(projectPath);
+        return true;
+    }
+    
     // Analyze current project structure
     analyzeProject(projectPath);
     
@@ -80,8 +89,8 @@ bool UpdateManager::renumberChapters(const QString& projectPath)
             QString newFileName = generateChapterFileName(newChapterNumber, chapter.name);
             QString newFilePath = QDir(projectPath).filePath("chapters/" + newFileName);
             
-            // Rename file if necessary
-            if (chapter.filePath != newFilePath) {
+            // Rename file if necessary (manifest projects keep stable file names)
+            if (!usesChapterManifest(projectPath) && chapter.filePath != newFilePath) {
                 if (!renameProjectFile(chapter.filePath, newFilePath)) {
                     emit updateError("Failed to rename chapter file: " + chapter.fileName);
                     return false;
@@ -115,6 +124,10 @@ bool UpdateManager::renumberSubsections(const QString& projectPath, int chapterN
 {
     qDebug() << "Renumbering subsections for chapter" << chapterNumber;
     
+    if (usesComputedNumbering(projectPath)) {
+        return true;
+    }
+    
     const QList<ChapterInfo>& chapters = m_projectChapters[projectPath];
     
     // Find the chapter
@@ -151,6 +164,19 @@ bool UpdateManager::moveChapter(const QString& projectPath, int fromIndex, int t
 {
     qDebug() << "Moving chapter from index" << fromIndex << "to" << toIndex;
     
+    // Manifest projects reorder with a single metadata write; display
+    // numbers are derived from the manifest when read or exported
+    if (usesChapterManifest(projectPath)) {
+        if (!projectManagerFor(projectPath)->moveChapterInOrder(fromIndex, toIndex)) {
+            emit updateError("Invalid chapter indices for move operation");
+            return false;
+        }
+        
+        emit chapterMoved(projectPath, fromIndex, toIndex);
+        emit numberingUpdated(projectPath);
+        return true;
+    }
+    
     QList<ChapterInfo>& chapters = m_projectChapters[projectPath];
     
     if (fromIndex < 0 || fromIndex >= chapters.size() || toIndex < 0 || toIndex >= chapters.size()) {
@@ -248,6 +274,21 @@ void UpdateManager::analyzeProject(const QString& projectPath)
         return;
     }
     
+    // Manifest order is authoritative; numbers follow manifest position
+    if (usesChapterManifest(projectPath)) {
+        const QStringList chapterFiles = projectManagerFor(projectPath)->getChapterFiles();
+        for (int i = 0; i < chapterFiles.size(); ++i) {
+            ChapterInfo chapter = parseChapterFile(chaptersDir.filePath(chapterFiles[i]));
+            chapter.chapterNumber = i + 1;
+            if (!chapter.name.isEmpty()) {
+                chapters.append(chapter);
+            }
+        }
+        
+        qDebug() << "Found" << chapters.size() << "chapters in manifest";
+        return;
+    }
+    
     // Get all chapter files
     QStringList filters;
     filters << "*.md" << "*.txt";
@@ -269,6 +310,117 @@ void UpdateManager::analyzeProject(const QString& projectPath)
     qDebug() << "Found" << chapters.size() << "chapters";
 }
 
+ProjectManager* UpdateManager::projectManagerFor(const QString& projectPath) const
+{
+    return m_workspace ? m_workspace->getProject(projectPath) : nullptr;
+}
+
+bool UpdateManager::usesChapterManifest(const QString& projectPath) const
+{
+    ProjectManager* manager = projectManagerFor(projectPath);
+    return manager && !manager->getChapterFiles().isEmpty();
+}
+
+bool UpdateManager::usesComputedNumbering(const QString& projectPath) const
+{
+    ProjectManager* manager = projectManagerFor(projectPath);
+    return manager && manager->isComputedHeadingNumbering();
+}
+
+ChapterOutline UpdateManager::getChapterOutline(const QString& filePath) const
+{
+    QFileInfo fileInfo(filePath);
+    
+    // Reuse the cached outline while the file is unchanged on disk
+    auto it = m_outlineCache.constFind(filePath);
+    if (it != m_outlineCache.constEnd() &&
+        it->lastModified == fileInfo.lastModified() &&
+        it->fileSize == fileInfo.size()) {
+        return *it;
+    }
+    
+    ChapterOutline outline;
+    outline.lastModified = fileInfo.lastModified();
+    outline.fileSize = fileInfo.size();
+    
+    QFile file(filePath);
+    if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        QTextStream in(&file);
+        QString content = in.readAll();
+        
+        QRegularExpressionMatch titleMatch = CHAPTER_REGEX.match(content);
+        outline.title = titleMatch.hasMatch() ? 
+            stripHeadingNumber(titleMatch.captured(1).trimmed()) : fileInfo.baseName();
+        
+        QRegularExpressionMatchIterator subsectionMatches = SUBSECTION_REGEX.globalMatch(content);
+        while (subsectionMatches.hasNext()) {
+            QRegularExpressionMatch match = subsectionMatches.next();
+            outline.subsections.append(stripHeadingNumber(match.captured(1).trimmed()));
+        }
+    }
+    
+    m_outlineCache[filePath] = outline;
+    return outline;
+}
+
+QString UpdateManager::renderNumberedContent(const QString& content, int chapterNumber)
+{
+    QStringList lines = content.split('\n');
+    
+    // Apply numbers to a copy of the text for export; the file is not touched
+    bool chapterHeadingDone = false;
+    int subsectionNumber = 0;
+    for (QString& line : lines) {
+        QRegularExpressionMatch subsectionMatch = SUBSECTION_REGEX.match(line);
+        if (subsectionMatch.hasMatch()) {
+            QString title = stripHeadingNumber(subsectionMatch.captured(1).trimmed());
+            line = formatSubsectionHeading(chapterNumber, ++subsectionNumber, title);
+            continue;
+        }
+        
+        QRegularExpressionMatch chapterMatch = CHAPTER_REGEX.match(line);
+        if (!chapterHeadingDone && chapterMatch.hasMatch()) {
+            QString title = stripHeadingNumber(chapterMatch.captured(1).trimmed());
+            line = formatChapterHeading(chapterNumber, title);
+            chapterHeadingDone = true;
+        }
+    }
+    
+    return lines.join('\n');
+}
+
+QString UpdateManager::stripHeadingNumber(const QString& heading)
+{
+    // "Chapter 3: Title" -> "Title", "2.1 - Title" -> "Title". Bare "Chapter 1" and
+    // "2.1" are the headings formatChapterHeading()/formatSubsectionHeading() write
+    // for untitled sections, so they read back as "". Anything else keeps its
+    // number: "1984" and "3 Days Later" are titles, not numbering.
+    if (UNTITLED_HEADING_REGEX.match(heading).hasMatch()) {
+        return QString();
+    }
+    
+    QString title = heading;
+    title.remove(HEADING_NUMBER_REGEX);
+    title = title.trimmed();
+    return title.isEmpty() ? heading : title;
+}
+
+QString UpdateManager::formatChapterHeading(int chapterNumber, const QString& title)
+{
+    if (title.isEmpty()) {
+        return QString("# Chapter %1").arg(chapterNumber);
+    }
+    return QString("# Chapter %1: %2").arg(chapterNumber).arg(title);
+}
+
+QString UpdateManager::formatSubsectionHeading(int chapterNumber, int subsectionNumber, const QString& title)
+{
+    if (title.isEmpty()) {
+        return QString("## %1.%2").arg(chapterNumber).arg(subsectionNumber);
+    }
+    return QString("## %1.%2: %3").arg(chapterNumber).arg(subsectionNumber).arg(title);
+}
+
 ChapterInfo UpdateManager::parseChapterFile(const QString& filePath) const
 {
     ChapterInfo info;
@@ -379,7 +531,7 @@ bool UpdateManager::updateChapterFile(const QString& filePath, const ChapterInfo
     file.close();
     
     // Update chapter header
-    QString newHeader = QString("# Chapter %1: %2").arg(info.chapterNumber).arg(info.name);
+    QString newHeader = formatChapterHeading(info.chapterNumber, stripHeadingNumber(info.name));
     content.replace(CHAPTER_REGEX, newHeader);
     
     // Write back to file
@@ -411,10 +563,9 @@ bool UpdateManager::updateSubsectionsInFile(const QString& filePath, const QList
         QRegularExpressionMatch match = SUBSECTION_REGEX.match(lines[i]);
         if (match.hasMatch()) {
             const SubsectionInfo& subsection = subsections[subsectionIndex];
-            lines[i] = QString("## %1.%2: %3")
-                      .arg(subsection.chapterNumber)
-                      .arg(subsection.subsectionNumber)
-                      .arg(subsection.title);
+            lines[i] = formatSubsectionHeading(subsection.chapterNumber,
+                                               subsection.subsectionNumber,
+                                               stripHeadingNumber(subsection.title));
             subsectionIndex++;
         }
     }
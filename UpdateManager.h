@@ -14,9 +14,11 @@
 #include <QFileInfo>
 #include <QTreeWidgetItem>
 #include <QRegularExpression>
+#include <QDateTime>
 
 class ProjectTreeWidget;
 class ProjectManager;
+class Workspace;
 
 struct ChapterInfo {
     QString name;
@@ -27,6 +29,13 @@ struct ChapterInfo {
     QTreeWidgetItem* treeItem;
 };
 
+struct ChapterOutline {
+    QString title;            // Chapter heading without any stored number
+    QStringList subsections;  // Subsection headings without stored numbers
+    QDateTime lastModified;   // File state the outline was parsed from
+    qint64 fileSize;
+};
+
 struct SubsectionInfo {
     QString title;
     int chapterNumber;
@@ -45,7 +54,7 @@ public:
 
     // Set dependencies
     void setProjectTree(ProjectTreeWidget* tree);
-    void setProjectManager(ProjectManager* manager);
+    void setWorkspace(Workspace* workspace);
     
     // Chapter operations
     bool renumberChapters(const QString& projectPath);
@@ -66,6 +75,14 @@ public:
     bool updateFileReferences(const QString& filePath, const QHash<QString, QString>& referenceMap);
     bool renameProjectFile(const QString& oldPath, const QString& newPath);
     
+    // Computed heading numbering (no file writes)
+    bool usesComputedNumbering(const QString& projectPath) const;
+    ChapterOutline getChapterOutline(const QString& filePath) const;
+    static QString renderNumberedContent(const QString& content, int chapterNumber);   // Safe on worker threads
+    static QString stripHeadingNumber(const QString& heading);
+    static QString formatChapterHeading(int chapterNumber, const QString& title);
+    static QString formatSubsectionHeading(int chapterNumber, int subsectionNumber, const QString& title);
+    
     // Cross-reference tracking
     QStringList findCrossReferences(const QString& projectPath, const QString& targetReference) const;
     bool updateCrossReferences(const QString& projectPath, const QString& oldReference, const QString& newReference);
@@ -81,6 +98,8 @@ signals:
 private:
     // Internal helpers
     void analyzeProject(const QString& projectPath);
+    ProjectManager* projectManagerFor(const QString& projectPath) const;   // Null unless the project is open
+    bool usesChapterManifest(const QString& projectPath) const;
     ChapterInfo parseChapterFile(const QString& filePath) const;
     QList<SubsectionInfo> parseSubsections(const QString& filePath, int chapterNumber) const;
     bool updateChapterFile(const QString& filePath, const ChapterInfo& info) const;
@@ -100,15 +119,18 @@ private:
     
     // Data storage
     ProjectTreeWidget* m_projectTree;
-    ProjectManager* m_projectManager;
+    Workspace* m_workspace;
     QHash<QString, QList<ChapterInfo>> m_projectChapters;  // projectPath -> chapters
     QHash<QString, QStringList> m_existingNames;  // projectPath -> names by type
+    mutable QHash<QString, ChapterOutline> m_outlineCache;  // filePath -> outline
     
     // Constants
     static const QString BACKUP_SUFFIX;
     static const int MAX_BACKUPS;
     static const QRegularExpression CHAPTER_REGEX;
     static const QRegularExpression SUBSECTION_REGEX;
+    static const QRegularExpression HEADING_NUMBER_REGEX;
+    static const QRegularExpression UNTITLED_HEADING_REGEX;
 };
 
 #endif // UPDATEMANAGER_H
\ No newline at end of file
@@ -0,0 +1,126 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "VisibilityTracker.h"
+#include "EditorWidget.h"
+#include <QEvent>
+#include <QWidget>
+
+VisibilityTracker::VisibilityTracker(QObject *parent)
+    : QObject(parent)
+{
+}
+
+VisibilityTracker::~VisibilityTracker() = default;
+
+void VisibilityTracker::watchEditor(EditorWidget* editor)
+{
+    if (!editor || m_visible.contains(editor)) {
+        return;
+    }
+    
+    editor->installEventFilter(this);
+    connect(editor, &QObject::destroyed, this, [this, editor]() {
+        m_visible.remove(editor);
+    });
+    
+    m_visible.insert(editor, computeVisible(editor));
+    watchWindow(editor->window());
+    emit visibilityChanged(editor, m_visible.value(editor));
+}
+
+void VisibilityTracker::unwatchEditor(EditorWidget* editor)
+{
+    if (m_visible.remove(editor) == 0) {
+        return;
+    }
+    
+    editor->removeEventFilter(this);
+    disconnect(editor, &QObject::destroyed, this, nullptr);
+}
+
+int VisibilityTracker::getVisibleCount() const
+{
+    int count = 0;
+    for (bool visible : m_visible) {
+        if (visible) {
+            ++count;
+        }
+    }
+    
+    return count;
+}
+
+bool VisibilityTracker::eventFilter(QObject* watched, QEvent* event)
+{
+    switch (event->type()) {
+        case QEvent::Show:
+        case QEvent::Hide:
+        case QEvent::ParentChange:
+            if (EditorWidget* editor = qobject_cast<EditorWidget*>(watched)) {
+                // Detaching or docking moves the editor to another window
+                if (event->type() == QEvent::ParentChange) {
+                    watchWindow(editor->window());
+                }
+                update(editor);
+            } else if (m_windows.contains(static_cast<QWidget*>(watched))) {
+                updateWindow(static_cast<QWidget*>(watched));
+            }
+            break;
+        case QEvent::WindowStateChange:
+            if (m_windows.contains(static_cast<QWidget*>(watched))) {
+                updateWindow(static_cast<QWidget*>(watched));
+            }
+            break;
+        default:
+            break;
+    }
+    
+    return QObject::eventFilter(watched, event);
+}
+
+void VisibilityTracker::update(EditorWidget* editor)
+{
+    auto it = m_visible.find(editor);
+    if (it == m_visible.end()) {
+        return;
+    }
+    
+    bool visible = computeVisible(editor);
+    if (*it != visible) {
+        *it = visible;
+        emit visibilityChanged(editor, visible);
+    }
+}
+
+void VisibilityTracker::updateWindow(QWidget* window)
+{
+    const QList<EditorWidget*> editors = m_visible.keys();
+    for (EditorWidget* editor : editors) {
+        if (editor->window() == window) {
+            update(editor);
+        }
+    }
+}
+
+void VisibilityTracker::watchWindow(QWidget* window)
+{
+    if (!window || m_windows.contains(window)) {
+        return;
+    }
+    
+    window->installEventFilter(this);
+    m_windows.insert(window);
+    connect(window, &QObject::destroyed, this, [this, window]() {
+        m_windows.remove(window);
+    });
+}
+
+bool VisibilityTracker::computeVisible(EditorWidget* editor)
+{
+    // isVisible() covers every ancestor, i.e. inactive tabs and hidden panes
+    return editor->isVisible() && !editor->window()->isMinimized();
+}
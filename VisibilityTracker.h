@@ -0,0 +1,51 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef VISIBILITYTRACKER_H
+#define VISIBILITYTRACKER_H
+
+#include <QObject>
+#include <QHash>
+#include <QSet>
+
+class EditorWidget;
+class QWidget;
+
+// Knows which open editors can actually be seen. An editor is hidden when
+// its tab is not current in a DraggableTabWidget or pane, or when its
+// window (main window or DetachedTabWindow) is minimized. Works from
+// show/hide and window state events, so it follows editors wherever tabs,
+// panes and detached windows move them.
+class VisibilityTracker : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit VisibilityTracker(QObject *parent = nullptr);
+    ~VisibilityTracker();
+
+    void watchEditor(EditorWidget* editor);
+    void unwatchEditor(EditorWidget* editor);
+    bool isVisible(EditorWidget* editor) const { return m_visible.value(editor, false); }
+    int getVisibleCount() const;
+
+signals:
+    void visibilityChanged(EditorWidget* editor, bool visible);
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    void update(EditorWidget* editor);
+    void updateWindow(QWidget* window);
+    void watchWindow(QWidget* window);
+    static bool computeVisible(EditorWidget* editor);
+
+    QHash<EditorWidget*, bool> m_visible;
+    QSet<QWidget*> m_windows;   // Top-level windows holding a watched editor
+};
+
+#endif // VISIBILITYTRACKER_H
@@ -0,0 +1,225 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "WordFrequencyAnalyzer.h"
+#include "TaskScheduler.h"
+#include <QFile>
+#include <QSet>
+#include <QTextStream>
+#include <QDebug>
+#include <algorithm>
+#include <utility>
+
+WordFrequencyAnalyzer::WordFrequencyAnalyzer(QObject *parent)
+    : QObject(parent)
+    , m_analysis(this)
+    , m_analysisQueued(false)
+{
+}
+
+WordFrequencyAnalyzer::~WordFrequencyAnalyzer() = default;
+
+void WordFrequencyAnalyzer::analyze(const QStringList& chapterPaths, const QHash<QString, QString>& openTexts)
+{
+    m_chapterOrder = chapterPaths;
+    m_openTexts = openTexts;
+    
+    // Only one run at a time; the newest request runs when it ends
+    if (m_analysis.isRunning()) {
+        m_analysisQueued = true;
+        m_analysis.cancel();
+        return;
+    }
+    
+    // Workers read the previous tables as a cache; QHash copies are shared
+    QHash<QString, ChapterTable> cache = m_tables.chapters;
+    QHash<QString, QString> texts = m_openTexts;
+    m_openTexts.clear();
+    
+    auto map = [cache, texts](const QString& chapterPath) {
+        auto openText = texts.constFind(chapterPath);
+        if (openText != texts.constEnd()) {
+            return tabulate(chapterPath, *openText, cache);
+        }
+        
+        QFile file(chapterPath);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            qDebug() << "Cannot read chapter for word frequency:" << chapterPath;
+            ChapterTable empty;
+            empty.chapterPath = chapterPath;
+            return empty;
+        }
+        QTextStream in(&file);
+        return tabulate(chapterPath, in.readAll(), cache);
+    };
+    
+    m_analysis.start(TaskScheduler::instance()->mappedReduced<ProjectTables>(TaskScheduler::AnalysisLane, "frequency",
+                                                                             chapterPaths, map, &WordFrequencyAnalyzer::mergeTable),
+                     [this]() { onAnalysisFinished(); });
+}
+
+void WordFrequencyAnalyzer::clear()
+{
+    m_analysis.stop();
+    m_analysisQueued = false;
+    m_chapterOrder.clear();
+    m_openTexts.clear();
+    m_tables = ProjectTables();
+    emit analysisFinished();
+}
+
+WordFrequencyAnalyzer::Results WordFrequencyAnalyzer::takeResults()
+{
+    m_analysis.stop();
+    m_analysisQueued = false;
+    m_openTexts.clear();
+    
+    Results results;
+    results.chapterOrder = std::exchange(m_chapterOrder, {});
+    results.tables = std::exchange(m_tables, ProjectTables());
+    return results;
+}
+
+void WordFrequencyAnalyzer::restoreResults(Results results)
+{
+    m_analysis.stop();
+    m_analysisQueued = false;
+    m_openTexts.clear();
+    
+    m_chapterOrder = std::move(results.chapterOrder);
+    m_tables = std::move(results.tables);
+    emit analysisFinished();
+}
+
+qint64 WordFrequencyAnalyzer::Results::estimateMemoryUsage() const
+{
+    // Words average well under 16 characters; each count costs a hash node
+    const qint64 entryBytes = sizeof(QString) + 16 * sizeof(QChar) + sizeof(int) + sizeof(void*);
+    qint64 bytes = tables.counts.size() * entryBytes;
+    for (const ChapterTable& table : tables.chapters) {
+        bytes += sizeof(ChapterTable) + table.counts.size() * entryBytes;
+    }
+    
+    return bytes;
+}
+
+QList<WordCount> WordFrequencyAnalyzer::getRankedWords(const QString& chapterPath, int limit, bool skipCommonWords) const
+{
+    const QHash<QString, int>* counts = &m_tables.counts;
+    int totalWords = m_tables.totalWords;
+    if (!chapterPath.isEmpty()) {
+        auto chapter = m_tables.chapters.constFind(chapterPath);
+        if (chapter == m_tables.chapters.constEnd()) {
+            return QList<WordCount>();
+        }
+        counts = &chapter->counts;
+        totalWords = chapter->totalWords;
+    }
+    
+    QList<WordCount> ranked;
+    ranked.reserve(counts->size());
+    for (auto it = counts->constBegin(); it != counts->constEnd(); ++it) {
+        if (skipCommonWords && isCommonWord(it.key())) {
+            continue;
+        }
+        ranked.append({it.key(), it.value(), totalWords > 0 ? it.value() * 1000.0 / totalWords : 0.0});
+    }
+    
+    // Only the top of the table is shown, so a partial sort is enough
+    auto byCount = [](const WordCount& a, const WordCount& b) {
+        return (a.count != b.count) ? a.count > b.count : a.word < b.word;
+    };
+    if (limit > 0 && limit < ranked.size()) {
+        std::partial_sort(ranked.begin(), ranked.begin() + limit, ranked.end(), byCount);
+        ranked.resize(limit);
+    } else {
+        std::sort(ranked.begin(), ranked.end(), byCount);
+    }
+    
+    return ranked;
+}
+
+int WordFrequencyAnalyzer::getTotalWords(const QString& chapterPath) const
+{
+    if (chapterPath.isEmpty()) {
+        return m_tables.totalWords;
+    }
+    
+    return m_tables.chapters.value(chapterPath).totalWords;
+}
+
+bool WordFrequencyAnalyzer::isCommonWord(const QString& word)
+{
+    // Function words drown out the crutch words editors are looking for
+    static const QSet<QString> commonWords = {
+        "a", "an", "and", "are", "as", "at", "be", "but", "by", "for", "from", "had", "has",
+        "have", "he", "her", "him", "his", "i", "if", "in", "into", "is", "it", "its", "me",
+        "my", "no", "not", "of", "on", "or", "our", "she", "so", "than", "that", "the",
+        "their", "them", "then", "there", "they", "this", "to", "up", "us", "was", "we",
+        "were", "what", "when", "which", "who", "will", "with", "would", "you", "your"
+    };
+    return commonWords.contains(word);
+}
+
+void WordFrequencyAnalyzer::onAnalysisFinished()
+{
+    QFuture<ProjectTables> future = m_analysis.finish();
+    
+    if (m_analysisQueued) {
+        m_analysisQueued = false;
+        analyze(m_chapterOrder, m_openTexts);
+        return;
+    }
+    
+    m_tables = future.result();
+    emit analysisFinished();
+}
+
+WordFrequencyAnalyzer::ChapterTable WordFrequencyAnalyzer::tabulate(const QString& chapterPath, const QString& text,
+                                                                    const QHash<QString, ChapterTable>& cache)
+{
+    size_t contentHash = qHash(text);
+    auto cached = cache.constFind(chapterPath);
+    if (cached != cache.constEnd() && cached->contentHash == contentHash) {
+        return *cached;
+    }
+    
+    ChapterTable table;
+    table.chapterPath = chapterPath;
+    table.contentHash = contentHash;
+    
+    // Words are letter runs, with inner apostrophes kept ("don't", "Anna's")
+    int i = 0;
+    while (i < text.size()) {
+        if (!text[i].isLetter()) {
+            ++i;
+            continue;
+        }
+        
+        int start = i;
+        while (i < text.size() && (text[i].isLetter() ||
+               ((text[i] == QLatin1Char('\'') || text[i] == QChar(0x2019)) &&
+                i + 1 < text.size() && text[i + 1].isLetter()))) {
+            ++i;
+        }
+        
+        QString word = text.mid(start, i - start).toLower();
+        word.replace(QChar(0x2019), QLatin1Char('\''));
+        table.counts[word]++;
+        table.totalWords++;
+    }
+    
+    return table;
+}
+
+void WordFrequencyAnalyzer::mergeTable(ProjectTables& project, const ChapterTable& chapter)
+{
+    project.totalWords += chapter.totalWords;
+    for (auto it = chapter.counts.constBegin(); it != chapter.counts.constEnd(); ++it) {
+        project.counts[it.key()] += it.value();
+    }
+    project.chapters.insert(chapter.chapterPath, chapter);
+}
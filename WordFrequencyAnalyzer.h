@@ -0,0 +1,91 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef WORDFREQUENCYANALYZER_H
+#define WORDFREQUENCYANALYZER_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QList>
+#include "TaskWatcher.h"
+
+struct WordCount {
+    QString word;
+    int count = 0;
+    double perThousand = 0.0;   // Occurrences per 1000 words of the scope
+};
+
+// Ranks word usage per chapter and across the project. Chapters are
+// tokenized in parallel and their tables merged in a reduce step; a
+// chapter's table is reused while its content hash is unchanged.
+class WordFrequencyAnalyzer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit WordFrequencyAnalyzer(QObject *parent = nullptr);
+    ~WordFrequencyAnalyzer();
+
+    // Analysis; openTexts supplies editor content by chapter path
+    void analyze(const QStringList& chapterPaths,
+                 const QHash<QString, QString>& openTexts = QHash<QString, QString>());
+    void clear();
+    bool isAnalyzing() const { return m_analysis.isRunning(); }
+
+    // Results; an empty chapterPath means the whole project
+    QList<WordCount> getRankedWords(const QString& chapterPath = QString(), int limit = 200,
+                                    bool skipCommonWords = true) const;
+    int getTotalWords(const QString& chapterPath = QString()) const;
+    QStringList getChapterPaths() const { return m_chapterOrder; }
+
+    // Results of one project, parked while another project is active
+    struct Results;
+    Results takeResults();                  // Leaves the analyzer empty
+    void restoreResults(Results results);   // Supersedes any running analysis
+
+    static bool isCommonWord(const QString& word);
+
+signals:
+    void analysisFinished();
+
+private slots:
+    void onAnalysisFinished();
+
+private:
+    struct ChapterTable {
+        QString chapterPath;
+        size_t contentHash = 0;
+        int totalWords = 0;
+        QHash<QString, int> counts;   // Lower-cased word -> occurrences
+    };
+
+    struct ProjectTables {
+        int totalWords = 0;
+        QHash<QString, int> counts;
+        QHash<QString, ChapterTable> chapters;   // chapterPath -> table
+    };
+
+    static ChapterTable tabulate(const QString& chapterPath, const QString& text,
+                                 const QHash<QString, ChapterTable>& cache);
+    static void mergeTable(ProjectTables& project, const ChapterTable& chapter);
+
+    QStringList m_chapterOrder;
+    QHash<QString, QString> m_openTexts;     // Editor content for a queued run
+    ProjectTables m_tables;                  // Latest results; also the cache
+    TaskWatcher<ProjectTables> m_analysis;   // Running while analyzing
+    bool m_analysisQueued;
+};
+
+struct WordFrequencyAnalyzer::Results {
+    QStringList chapterOrder;
+    ProjectTables tables;
+
+    qint64 estimateMemoryUsage() const;
+};
+
+#endif // WORDFREQUENCYANALYZER_H
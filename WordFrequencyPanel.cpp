@@ -0,0 +1,117 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "WordFrequencyPanel.h"
+#include "WordFrequencyAnalyzer.h"
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QFileInfo>
+
+WordFrequencyPanel::WordFrequencyPanel(QWidget *parent)
+    : QWidget(parent)
+    , m_analyzer(nullptr)
+    , m_layout(nullptr)
+    , m_scopeCombo(nullptr)
+    , m_skipCommonCheck(nullptr)
+    , m_analyzeButton(nullptr)
+    , m_summaryLabel(nullptr)
+    , m_wordTree(nullptr)
+{
+    setupUI();
+}
+
+WordFrequencyPanel::~WordFrequencyPanel()
+{
+}
+
+void WordFrequencyPanel::setupUI()
+{
+    m_layout = new QVBoxLayout(this);
+    m_layout->setContentsMargins(4, 4, 4, 4);
+    
+    QHBoxLayout* controlsLayout = new QHBoxLayout();
+    m_scopeCombo = new QComboBox(this);
+    m_analyzeButton = new QPushButton("Analyze", this);
+    m_analyzeButton->setToolTip("Count words across all chapters");
+    controlsLayout->addWidget(m_scopeCombo, 1);
+    controlsLayout->addWidget(m_analyzeButton);
+    m_layout->addLayout(controlsLayout);
+    
+    m_skipCommonCheck = new QCheckBox("Hide common words", this);
+    m_skipCommonCheck->setChecked(true);
+    m_layout->addWidget(m_skipCommonCheck);
+    
+    m_summaryLabel = new QLabel("Not analyzed yet", this);
+    m_layout->addWidget(m_summaryLabel);
+    
+    m_wordTree = new QTreeWidget(this);
+    m_wordTree->setHeaderLabels({"Word", "Count", "Per 1000"});
+    m_wordTree->setRootIsDecorated(false);
+    m_wordTree->header()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    m_layout->addWidget(m_wordTree);
+    
+    connect(m_analyzeButton, &QPushButton::clicked, this, &WordFrequencyPanel::analyzeRequested);
+    connect(m_scopeCombo, &QComboBox::currentIndexChanged, this, &WordFrequencyPanel::refresh);
+    connect(m_skipCommonCheck, &QCheckBox::toggled, this, &WordFrequencyPanel::refresh);
+}
+
+void WordFrequencyPanel::setAnalyzer(WordFrequencyAnalyzer* analyzer)
+{
+    if (m_analyzer) {
+        disconnect(m_analyzer, nullptr, this, nullptr);
+    }
+    
+    m_analyzer = analyzer;
+    
+    if (m_analyzer) {
+        connect(m_analyzer, &WordFrequencyAnalyzer::analysisFinished, this, [this]() {
+            rebuildScopes();
+            refresh();
+        });
+    }
+}
+
+void WordFrequencyPanel::rebuildScopes()
+{
+    // Keep the selected scope across runs when the chapter still exists
+    QString selected = m_scopeCombo->currentData().toString();
+    
+    m_scopeCombo->blockSignals(true);
+    m_scopeCombo->clear();
+    m_scopeCombo->addItem("Whole Project", QString());
+    for (const QString& chapterPath : m_analyzer->getChapterPaths()) {
+        m_scopeCombo->addItem(QFileInfo(chapterPath).baseName(), chapterPath);
+    }
+    m_scopeCombo->setCurrentIndex(qMax(0, m_scopeCombo->findData(selected)));
+    m_scopeCombo->blockSignals(false);
+}
+
+void WordFrequencyPanel::refresh()
+{
+    m_wordTree->clear();
+    m_analyzeButton->setEnabled(m_analyzer && !m_analyzer->isAnalyzing());
+    if (!m_analyzer) {
+        return;
+    }
+    
+    QString chapterPath = m_scopeCombo->currentData().toString();
+    const QList<WordCount> words = m_analyzer->getRankedWords(chapterPath, MAX_ROWS, m_skipCommonCheck->isChecked());
+    
+    QList<QTreeWidgetItem*> items;
+    items.reserve(words.size());
+    for (const WordCount& word : words) {
+        QTreeWidgetItem* item = new QTreeWidgetItem();
+        item->setText(0, word.word);
+        item->setText(1, QString::number(word.count));
+        item->setText(2, QString::number(word.perThousand, 'f', 1));
+        item->setTextAlignment(1, Qt::AlignRight);
+        item->setTextAlignment(2, Qt::AlignRight);
+        items.append(item);
+    }
+    m_wordTree->addTopLevelItems(items);
+    
+    m_summaryLabel->setText(QString("%1 words").arg(m_analyzer->getTotalWords(chapterPath)));
+}
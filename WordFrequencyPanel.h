@@ -0,0 +1,53 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef WORDFREQUENCYPANEL_H
+#define WORDFREQUENCYPANEL_H
+
+#include <QWidget>
+#include <QTreeWidget>
+#include <QComboBox>
+#include <QCheckBox>
+#include <QLabel>
+#include <QPushButton>
+#include <QVBoxLayout>
+
+class WordFrequencyAnalyzer;
+
+// Ranked word-frequency table for the project or a single chapter
+class WordFrequencyPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit WordFrequencyPanel(QWidget *parent = nullptr);
+    ~WordFrequencyPanel();
+
+    void setAnalyzer(WordFrequencyAnalyzer* analyzer);
+
+signals:
+    void analyzeRequested();
+
+public slots:
+    void refresh();
+
+private:
+    void setupUI();
+    void rebuildScopes();
+
+    // Constants
+    static const int MAX_ROWS = 200;
+
+    WordFrequencyAnalyzer* m_analyzer;
+    QVBoxLayout* m_layout;
+    QComboBox* m_scopeCombo;
+    QCheckBox* m_skipCommonCheck;
+    QPushButton* m_analyzeButton;
+    QLabel* m_summaryLabel;
+    QTreeWidget* m_wordTree;
+};
+
+#endif // WORDFREQUENCYPANEL_H
@@ -0,0 +1,219 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#include "Workspace.h"
+#include "ProjectManager.h"
+#include "CharacterDatabase.h"
+#include <QFileInfo>
+#include <QDir>
+#include <algorithm>
+
+Workspace::Workspace(QObject *parent)
+    : QObject(parent)
+    , m_idleProject(new ProjectManager(this))
+    , m_active(m_idleProject)
+    , m_activationCount(0)
+    , m_memoryBudget(static_cast<qint64>(DEFAULT_MEMORY_BUDGET_MB) * 1024 * 1024)
+{
+}
+
+Workspace::~Workspace() = default;
+
+ProjectManager* Workspace::createProject(const QString& projectPath, const QString& projectName)
+{
+    if (ProjectManager* existing = getProject(projectPath)) {
+        return existing;
+    }
+    
+    ProjectManager* manager = new ProjectManager(this);
+    if (!manager->createProject(projectPath, projectName)) {
+        delete manager;
+        return nullptr;
+    }
+    
+    return addProject(manager);
+}
+
+ProjectManager* Workspace::openProject(const QString& projectFilePath)
+{
+    if (ProjectManager* existing = getProject(QFileInfo(projectFilePath).absolutePath())) {
+        return existing;
+    }
+    
+    ProjectManager* manager = new ProjectManager(this);
+    if (!manager->openProject(projectFilePath)) {
+        delete manager;
+        return nullptr;
+    }
+    
+    return addProject(manager);
+}
+
+bool Workspace::closeProject(const QString& projectPath)
+{
+    ProjectManager* manager = getProject(projectPath);
+    if (!manager) {
+        return false;
+    }
+    
+    // Hand over to the most recently used remaining project before this one goes
+    if (manager == m_active) {
+        ProjectManager* next = m_idleProject;
+        quint64 newest = 0;
+        for (ProjectManager* other : std::as_const(m_projects)) {
+            if (other != manager && m_lastActive.value(other, 0) >= newest) {
+                newest = m_lastActive.value(other, 0);
+                next = other;
+            }
+        }
+        activate(next);
+    }
+    
+    m_projects.remove(projectPath);
+    m_openOrder.removeAll(projectPath);
+    m_lastActive.remove(manager);
+    disconnect(manager, nullptr, this, nullptr);
+    disconnect(manager->getCharacterDatabase(), nullptr, this, nullptr);
+    
+    manager->closeProject();
+    manager->deleteLater();   // Its signals may still be on the stack
+    
+    emit projectRemoved(projectPath);
+    return true;
+}
+
+ProjectManager* Workspace::projectForFile(const QString& filePath) const
+{
+    if (filePath.isEmpty()) {
+        return nullptr;
+    }
+    
+    // Longest match, in case one project lives inside another's folder
+    QString cleanPath = QDir::cleanPath(filePath);
+    ProjectManager* owner = nullptr;
+    int ownerLength = -1;
+    for (auto it = m_projects.constBegin(); it != m_projects.constEnd(); ++it) {
+        QString projectPath = QDir::cleanPath(it.key());
+        if (cleanPath.startsWith(projectPath + "/") && projectPath.size() > ownerLength) {
+            owner = it.value();
+            ownerLength = projectPath.size();
+        }
+    }
+    
+    return owner;
+}
+
+bool Workspace::setActiveProject(const QString& projectPath)
+{
+    ProjectManager* manager = projectPath.isEmpty() ? m_idleProject : getProject(projectPath);
+    if (!manager) {
+        return false;
+    }
+    
+    activate(manager);
+    return true;
+}
+
+QString Workspace::getActiveProjectPath() const
+{
+    return m_active->getCurrentProjectPath();
+}
+
+void Workspace::setMemoryBudget(qint64 bytes)
+{
+    m_memoryBudget = qMax<qint64>(0, bytes);
+    enforceMemoryBudget();
+}
+
+qint64 Workspace::getMemoryUsage() const
+{
+    qint64 bytes = 0;
+    for (const ProjectManager* manager : m_projects) {
+        bytes += manager->estimateMemoryUsage();
+    }
+    
+    return bytes;
+}
+
+ProjectManager* Workspace::addProject(ProjectManager* manager)
+{
+    QString projectPath = manager->getCurrentProjectPath();
+    m_projects.insert(projectPath, manager);
+    m_openOrder.append(projectPath);
+    
+    // Shared views only follow the active project; matcher and save failures matter for all
+    connect(manager, &ProjectManager::chapterOrderChanged, this, [this, manager]() {
+        if (manager == m_active) {
+            emit chapterOrderChanged();
+        }
+    });
+    connect(manager, &ProjectManager::headingNumberingChanged, this, [this, manager](bool computed) {
+        if (manager == m_active) {
+            emit headingNumberingChanged(computed);
+        }
+    });
+    connect(manager->getCharacterDatabase(), &CharacterDatabase::charactersChanged, this, [this, manager]() {
+        if (manager == m_active) {
+            emit charactersChanged();
+        }
+    });
+    connect(manager->getCharacterDatabase(), &CharacterDatabase::matcherChanged, this, [this, manager]() {
+        emit matcherChanged(manager);
+        enforceMemoryBudget();
+    });
+    connect(manager, &ProjectManager::saveFailed, this, &Workspace::saveFailed);
+    
+    emit projectAdded(projectPath);
+    return manager;
+}
+
+void Workspace::activate(ProjectManager* manager)
+{
+    if (manager == m_active) {
+        return;
+    }
+    
+    m_active = manager;
+    if (manager != m_idleProject) {
+        m_lastActive.insert(manager, ++m_activationCount);
+    }
+    
+    // Rebuilt in the background if it was released; the switch itself doesn't wait
+    manager->restoreCaches();
+    emit activeProjectChanged(manager->getCurrentProjectPath());
+    
+    // Only now, so results the window parked with the previous project count too
+    enforceMemoryBudget();
+}
+
+void Workspace::enforceMemoryBudget()
+{
+    qint64 usage = getMemoryUsage();
+    if (usage <= m_memoryBudget) {
+        return;
+    }
+    
+    // The active project always keeps its caches
+    QList<ProjectManager*> candidates;
+    for (ProjectManager* manager : std::as_const(m_projects)) {
+        if (manager != m_active) {
+            candidates.append(manager);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [this](ProjectManager* a, ProjectManager* b) {
+        return m_lastActive.value(a, 0) < m_lastActive.value(b, 0);
+    });
+    
+    for (ProjectManager* manager : std::as_const(candidates)) {
+        if (usage <= m_memoryBudget) {
+            break;
+        }
+        
+        qint64 before = manager->estimateMemoryUsage();
+        manager->releaseCaches();
+        usage -= before - manager->estimateMemoryUsage();
+    }
+}
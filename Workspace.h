@@ -0,0 +1,83 @@
+/*
+ * NeuroDraft - Advanced Novel Writing Application
+ * Concept and Development: Ryon Shane Hall
+ * Built with Qt6 and C++20 for Linux
+ */
+
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+
+class ProjectManager;
+
+// Every open project, each with its own ProjectManager kept loaded, so
+// switching the active project only rebinds the window's shared services
+// (task scheduler, mention index, name dictionary) instead of reloading
+// anything; their results for a background project stay parked with it.
+// Derived data of background projects is released, least recently used
+// first, when the total goes over the memory budget.
+class Workspace : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit Workspace(QObject *parent = nullptr);
+    ~Workspace();
+
+    // Opening and closing; an already open project is returned as is
+    ProjectManager* createProject(const QString& projectPath, const QString& projectName);
+    ProjectManager* openProject(const QString& projectFilePath);
+    bool closeProject(const QString& projectPath);
+
+    // Lookup
+    ProjectManager* getProject(const QString& projectPath) const { return m_projects.value(projectPath, nullptr); }
+    ProjectManager* projectForFile(const QString& filePath) const;   // Null for files outside every project
+    QStringList getProjectPaths() const { return m_openOrder; }
+    int count() const { return m_projects.size(); }
+
+    // Active project; never null, a project-less manager stands in while none is open
+    bool setActiveProject(const QString& projectPath);
+    ProjectManager* getActiveProject() const { return m_active; }
+    QString getActiveProjectPath() const;
+
+    // Memory budget
+    void setMemoryBudget(qint64 bytes);
+    qint64 getMemoryBudget() const { return m_memoryBudget; }
+    qint64 getMemoryUsage() const;
+
+    // Constants
+    static const int DEFAULT_MEMORY_BUDGET_MB = 128;
+
+signals:
+    void projectAdded(const QString& projectPath);
+    void projectRemoved(const QString& projectPath);
+    void activeProjectChanged(const QString& projectPath);   // Empty when no project is open
+    
+    // Forwarded from the active project only
+    void chapterOrderChanged();
+    void headingNumberingChanged(bool computed);
+    void charactersChanged();
+    
+    // Forwarded from every project
+    void matcherChanged(ProjectManager* project);
+    void saveFailed(const QString& filePath, const QString& error);
+
+private:
+    ProjectManager* addProject(ProjectManager* manager);
+    void activate(ProjectManager* manager);
+    void enforceMemoryBudget();
+
+    ProjectManager* m_idleProject;
+    ProjectManager* m_active;
+    QHash<QString, ProjectManager*> m_projects;      // Project path -> manager (owned)
+    QStringList m_openOrder;
+    QHash<ProjectManager*, quint64> m_lastActive;    // Activation stamp, for LRU release
+    quint64 m_activationCount;
+    qint64 m_memoryBudget;
+};
+
+#endif // WORKSPACE_H